@@ -0,0 +1,38 @@
+/** @file
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdint.h>
+
+#ifndef CLOCK_H
+#define CLOCK_H
+
+/**
+ * @brief Get monotonic host time in milliseconds
+ *
+ * The value wraps around at 2^32, intervals are computed with unsigned subtraction.
+ * May be called from interrupt context.
+ *
+ * @return Current time in ms
+ */
+uint32_t clock_get_ms(void);
+
+/**
+ * @brief Get monotonic host time in microseconds
+ *
+ * The value wraps around at 2^32, intervals are computed with unsigned subtraction.
+ * May be called from interrupt context.
+ *
+ * @return Current time in us
+ */
+uint32_t clock_get_us(void);
+
+/**
+ * @brief Busy-wait for the specified time
+ *
+ * @param us Time to wait in us.
+ */
+void clock_delay_us(uint32_t us);
+
+#endif // CLOCK_H
@@ -0,0 +1,61 @@
+/** @file
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdint.h>
+
+#include <app_util_platform.h>
+#include <nrf_delay.h>
+#include <nrf_timer.h>
+
+#include "clock.h"
+#include "clock_nrf5sdk.h"
+
+#define CLOCK_TIMER       NRF_TIMER1
+#define CLOCK_TIMER_CC    0
+
+static uint64_t uptime_us;
+static uint32_t last_us;
+
+void clock_init(void)
+{
+	nrf_timer_mode_set(CLOCK_TIMER, NRF_TIMER_MODE_TIMER);
+	nrf_timer_bit_width_set(CLOCK_TIMER, NRF_TIMER_BIT_WIDTH_32);
+	nrf_timer_frequency_set(CLOCK_TIMER, NRF_TIMER_FREQ_1MHz);
+	nrf_timer_task_trigger(CLOCK_TIMER, NRF_TIMER_TASK_CLEAR);
+	nrf_timer_task_trigger(CLOCK_TIMER, NRF_TIMER_TASK_START);
+}
+
+uint32_t clock_get_us(void)
+{
+	uint32_t now;
+
+	CRITICAL_REGION_ENTER();
+	nrf_timer_task_trigger(CLOCK_TIMER, nrf_timer_capture_task_get(CLOCK_TIMER_CC));
+	now = nrf_timer_cc_read(CLOCK_TIMER, CLOCK_TIMER_CC);
+	CRITICAL_REGION_EXIT();
+
+	return now;
+}
+
+uint32_t clock_get_ms(void)
+{
+	uint32_t ms;
+
+	CRITICAL_REGION_ENTER();
+	uint32_t now = clock_get_us();
+
+	/* Extend the 32-bit timer to 64 bits */
+	uptime_us += now - last_us;
+	last_us = now;
+	ms = (uint32_t)(uptime_us / 1000U);
+	CRITICAL_REGION_EXIT();
+
+	return ms;
+}
+
+void clock_delay_us(uint32_t us)
+{
+	nrf_delay_us(us);
+}
@@ -0,0 +1,19 @@
+/** @file
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "clock.h"
+
+#ifndef CLOCK_NRF5SDK_H
+#define CLOCK_NRF5SDK_H
+
+/**
+ * @brief Start the free-running timer used as host time base
+ *
+ * clock_get_ms or clock_get_us must be called at least once every 71 minutes
+ * to keep track of timer overflows.
+ */
+void clock_init(void);
+
+#endif // CLOCK_NRF5SDK_H
@@ -12,6 +12,7 @@
 #include "nrfx_gpiote.h"
 #include "nrfx_twim.h"
 
+#include "clock_nrf5sdk.h"
 #include "i2c_nrf5sdk.h"
 #include "util.h"
 
@@ -19,6 +20,9 @@
 #include "regulator_npm2100.h"
 #include "mfd_npm2100.h"
 #include "gpio_npm2100.h"
+#include "irq_npm2100.h"
+#include "stats_npm2100.h"
+#include "timer_npm2100.h"
 
 #define HOST_SDA_PIN NRF_GPIO_PIN_MAP(0, 26)
 #define HOST_SCL_PIN NRF_GPIO_PIN_MAP(0, 27)
@@ -27,27 +31,43 @@
 #define PMIC_LDO_CTRL_PIN 0
 #define PMIC_INT_OUT_PIN  1
 
-#define V_TO_UV(v) ((v) * 1000000)
-
 static struct i2c_ctx npm2100_i2c_cxt;
 static struct i2c_dev npm2100_pmic = { .addr = 0x74, .context = &npm2100_i2c_cxt };
 static nrfx_twim_t npm2100_pmic_twim_inst = NRFX_TWIM_INSTANCE(0);
 
-static bool pmic_interrupt;
+static struct irq_npm2100 npm2100_irq;
+static struct stats_npm2100 npm2100_stats;
+static struct timer_npm2100_periodic npm2100_periodic;
 
 /**
  * @brief Timer interrupt handler.
  */
 static void in_pin_handler(nrfx_gpiote_pin_t pin, nrf_gpiote_polarity_t action) {
-    (void)pin;
     (void)action;
 
     if (pin == HOST_INT_PIN) {
-        nrfx_gpiote_in_event_disable(HOST_INT_PIN);
-        pmic_interrupt = true;
+        irq_npm2100_notify(&npm2100_irq);
     }
 }
 
+static void host_int_pin_disarm(void *user_data)
+{
+    (void)user_data;
+    nrfx_gpiote_in_event_disable(HOST_INT_PIN);
+}
+
+static void host_int_pin_arm(void *user_data)
+{
+    (void)user_data;
+    nrfx_gpiote_in_event_enable(HOST_INT_PIN, true);
+}
+
+static bool host_int_pin_active(void *user_data)
+{
+    (void)user_data;
+    return nrf_gpio_pin_read(HOST_INT_PIN) != 0;
+}
+
 /**
  * @brief Set up nPM2100 LDO.
  *
@@ -66,7 +86,8 @@ static void npm2100_ldo_setup(void)
     ret = regulator_npm2100_pin_ctrl(&npm2100_pmic, NPM2100_SOURCE_LDOSW, PMIC_LDO_CTRL_PIN, true);
     APP_ERROR_CHECK(ret);
 
-    ret = regulator_npm2100_set_voltage(&npm2100_pmic, NPM2100_SOURCE_LDOSW, V_TO_UV(2.5), V_TO_UV(2.5));
+    ret = regulator_npm2100_set_voltage_idx(&npm2100_pmic, NPM2100_SOURCE_LDOSW,
+                                            NPM2100_LDOSW_UV_TO_IDX(NPM2100_V_TO_UV(2.5)));
     APP_ERROR_CHECK(ret);
 
     ret = regulator_npm2100_enable(&npm2100_pmic, NPM2100_SOURCE_LDOSW);
@@ -82,15 +103,8 @@ static void npm2100_ldo_setup(void)
 static void npm2100_timer_setup(uint32_t period_ms) {
     int ret;
 
-    ret = mfd_npm2100_stop_timer(&npm2100_pmic);
-    APP_ERROR_CHECK(ret);
-
-    /* it takes some time for the timer status to turn IDLE */
-    nrf_delay_ms(3);
-    ret = mfd_npm2100_set_timer(&npm2100_pmic, period_ms, NPM2100_TIMER_MODE_GENERAL_PURPOSE);
-    APP_ERROR_CHECK(ret);
-
-    ret = mfd_npm2100_enable_events(&npm2100_pmic, BIT(NPM2100_EVENT_SYS_TIMER_EXPIRY));
+    /* periodic timer, restarted on every expiry without accumulating drift */
+    ret = timer_npm2100_periodic_start(&npm2100_periodic, &npm2100_pmic, period_ms);
     APP_ERROR_CHECK(ret);
 
     /* nPM2100 GPIO1 as interrupt output, active high */
@@ -133,13 +147,44 @@ static int read_sensor_data(void)
     return 0;
 }
 
+/**
+ * @brief nPM2100 timer expiry handler: restart the timer first, then display ADC measurements.
+ */
+static void npm2100_timer_expiry_handler(struct i2c_dev *dev, enum mfd_npm2100_event_t event, void *user_data)
+{
+    int ret;
+
+    (void)dev;
+    (void)event;
+    (void)user_data;
+
+    ret = timer_npm2100_periodic_restart(&npm2100_periodic);
+    APP_ERROR_CHECK(ret);
+    read_sensor_data();
+
+    NRF_LOG_INFO("Timer expiries: %u, mean period: %u ms",
+            npm2100_stats.event[NPM2100_EVENT_SYS_TIMER_EXPIRY].count,
+            stats_npm2100_mean_ms(&npm2100_stats, NPM2100_EVENT_SYS_TIMER_EXPIRY));
+}
+
+static const struct mfd_npm2100_event_callback npm2100_event_callbacks[NPM2100_EVENT_MAX] = {
+    MFD_NPM2100_EVENT_CALLBACK(NPM2100_EVENT_SYS_TIMER_EXPIRY, npm2100_timer_expiry_handler, NULL),
+};
+
+static const struct irq_npm2100_config npm2100_irq_config = {
+    .callbacks = npm2100_event_callbacks,
+    .stats = &npm2100_stats,
+    .disarm = host_int_pin_disarm,
+    .arm = host_int_pin_arm,
+    .pin_active = host_int_pin_active,
+};
+
 /**
  * @brief Function for main application entry.
  */
 int main(void)
 {
     int ret;
-    uint32_t events;
 
     APP_ERROR_CHECK(NRF_LOG_INIT(NULL));
     NRF_LOG_DEFAULT_BACKENDS_INIT();
@@ -150,35 +195,41 @@ int main(void)
     ret = i2c_init(&npm2100_pmic, &npm2100_pmic_twim_inst, HOST_SDA_PIN, HOST_SCL_PIN);
     APP_ERROR_CHECK(ret);
 
+    clock_init();
+
+    struct mfd_npm2100_boot_info boot_info;
+
+    ret = mfd_npm2100_get_boot_info(&npm2100_pmic, &boot_info);
+    APP_ERROR_CHECK(ret);
+    NRF_LOG_INFO("Boot causes: 0x%x, latched events: 0x%x", boot_info.causes, boot_info.events);
+
+    ret = regulator_npm2100_init(&npm2100_pmic);
+    APP_ERROR_CHECK(ret);
+
+    stats_npm2100_init(&npm2100_stats, BIT(NPM2100_EVENT_SYS_TIMER_EXPIRY));
+    irq_npm2100_init(&npm2100_irq, &npm2100_pmic, &npm2100_irq_config);
+
     npm2100_ldo_setup();
 
     npm2100_timer_setup(2000);
-    
-    ret = mfd_npm2100_start_timer(&npm2100_pmic);
-    APP_ERROR_CHECK(ret);
 
     NRF_LOG_INFO("nPM2100 PMIC device OK");
     NRF_LOG_FLUSH();
 
     while (true)
     {
-        while (!pmic_interrupt) {
+        while (!irq_npm2100_pending(&npm2100_irq)) {
             __WFE();
         }
 
-        /* process events before reenabling the interrupt */
-        ret = mfd_npm2100_process_events(&npm2100_pmic, &events);
-        APP_ERROR_CHECK(ret);
+        uint32_t events;
 
-        if (events & BIT(NPM2100_EVENT_SYS_TIMER_EXPIRY)) {
-            /* restart the timer, display ADC measurements */
-            ret = mfd_npm2100_start_timer(&npm2100_pmic);
-            APP_ERROR_CHECK(ret);
-            read_sensor_data();
-        }
+        /* process events and dispatch them to handlers, then reenable the interrupt */
+        ret = irq_npm2100_process(&npm2100_irq, &events);
+        APP_ERROR_CHECK(ret);
 
-        pmic_interrupt = false;
-        nrfx_gpiote_in_event_enable(HOST_INT_PIN, true);
+        ret = regulator_npm2100_process_events(&npm2100_pmic, events);
+        APP_ERROR_CHECK(ret);
 
         NRF_LOG_FLUSH();
     }
@@ -0,0 +1,63 @@
+/** @file
+ * Copyright (c) 2019 Facebook.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef LIB_MATH_EXTRAS_H_
+#define LIB_MATH_EXTRAS_H_
+
+#include <stdint.h>
+
+/**
+ * @brief Count the number of leading zero bits in a 32-bit integer.
+ *
+ * @param x 32-bit integer value.
+ *
+ * @return The number of leading zero bits in @p x, or 32 if @p x is 0.
+ */
+static inline int u32_count_leading_zeros(uint32_t x)
+{
+#if defined(__GNUC__)
+	return (x == 0U) ? 32 : __builtin_clz(x);
+#else
+	int n;
+
+	if (x == 0U) {
+		return 32;
+	}
+
+	for (n = 0; (x & 0x80000000U) == 0U; n++) {
+		x <<= 1U;
+	}
+
+	return n;
+#endif
+}
+
+/**
+ * @brief Count the number of trailing zero bits in a 32-bit integer.
+ *
+ * @param x 32-bit integer value.
+ *
+ * @return The number of trailing zero bits in @p x, or 32 if @p x is 0.
+ */
+static inline int u32_count_trailing_zeros(uint32_t x)
+{
+#if defined(__GNUC__)
+	return (x == 0U) ? 32 : __builtin_ctz(x);
+#else
+	int n;
+
+	if (x == 0U) {
+		return 32;
+	}
+
+	for (n = 0; (x & 1U) == 0U; n++) {
+		x >>= 1U;
+	}
+
+	return n;
+#endif
+}
+
+#endif /* LIB_MATH_EXTRAS_H_ */
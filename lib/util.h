@@ -9,6 +9,9 @@
 /** Unsigned integer with bit position @p n set */
 #define BIT(n) (1UL << (n))
 
+/** 64-bit unsigned integer with bit position @p n set */
+#define BIT64(n) (1ULL << (n))
+
 /**
  * @brief Bit mask with bits 0 through <tt>n-1</tt> (inclusive) set,
  * or 0 if @p n is 0.
@@ -65,6 +68,42 @@
 #define DIV_ROUND_CLOSEST(n, d)                                                                    \
 	((((n) < 0) ^ ((d) < 0)) ? ((n) - ((d) / 2)) / (d) : ((n) + ((d) / 2)) / (d))
 
+/**
+ * @brief Compile-time assertion.
+ *
+ * @param EXPR Constant expression that must evaluate to true.
+ * @param MSG Optional message shown if the assertion fails.
+ */
+#ifndef BUILD_ASSERT
+#define BUILD_ASSERT(EXPR, MSG...) _Static_assert((EXPR), "" MSG)
+#endif
+
+/**
+ * @brief Evaluate to 0 if @p cond is true-or-nonzero, fail to compile otherwise.
+ *
+ * Usable where a static assertion can not be, e.g. inside an expression.
+ *
+ * @param cond Integer constant expression that must evaluate to true.
+ */
+#ifndef ZERO_OR_COMPILE_ERROR
+#define ZERO_OR_COMPILE_ERROR(cond) ((int)sizeof(char[1 - (2 * !(cond))]) - 1)
+#endif
+
+#ifndef MAX
+/** @brief Obtain the maximum of two values. */
+#define MAX(a, b) (((a) > (b)) ? (a) : (b))
+#endif
+
+#ifndef MIN
+/** @brief Obtain the minimum of two values. */
+#define MIN(a, b) (((a) < (b)) ? (a) : (b))
+#endif
+
+#ifndef CLAMP
+/** @brief Clamp a value to a given range. */
+#define CLAMP(val, low, high) (((val) <= (low)) ? (low) : MIN(val, high))
+#endif
+
 #ifndef ARRAY_SIZE
 /**
  * @brief Number of elements in the given @p array
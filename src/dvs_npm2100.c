@@ -0,0 +1,192 @@
+/** @file
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "clock.h"
+#include "dvs_npm2100.h"
+#include "i2c.h"
+#include "mfd_npm2100.h"
+#include "regulator_npm2100.h"
+#include "util.h"
+
+/* Lowest boost voltage setting that satisfies a load */
+static inline int32_t boost_uv(int32_t min_uv)
+{
+	if (min_uv <= NPM2100_BOOST_MIN_UV) {
+		return NPM2100_BOOST_MIN_UV;
+	}
+
+	return MIN(NPM2100_BOOST_MIN_UV +
+			   DIV_ROUND_UP(min_uv - NPM2100_BOOST_MIN_UV, NPM2100_BOOST_STEP_UV) *
+				   NPM2100_BOOST_STEP_UV,
+		   NPM2100_BOOST_MAX_UV);
+}
+
+/* Output voltage, the boost passes VBAT through when it is above the programmed voltage */
+static inline int32_t output_uv(const struct dvs_npm2100 *dvs, int32_t programmed_uv)
+{
+	return MAX(programmed_uv, dvs->vbat_uv);
+}
+
+/* Accumulate the energy saved since the last update, at the current output voltage */
+static void account(struct dvs_npm2100 *dvs)
+{
+	const struct dvs_npm2100_config *config = dvs->config;
+	int32_t drop_uv = config->nominal_uv - output_uv(dvs, dvs->programmed_uv);
+	uint32_t now = clock_get_ms();
+	uint32_t elapsed = now - dvs->last_ms;
+
+	dvs->last_ms = now;
+	dvs->elapsed_ms += elapsed;
+
+	/* uV * uA / 1000 is nW, nW * ms / 1000 is nJ */
+	if (drop_uv > 0) {
+		uint64_t saved_nw = (uint64_t)drop_uv * config->loads[dvs->load].load_ua / 1000U;
+
+		dvs->saved_nj += saved_nw * elapsed / 1000U;
+	}
+}
+
+static int program(struct dvs_npm2100 *dvs)
+{
+	int32_t target_uv = boost_uv(dvs->config->loads[dvs->load].min_uv);
+	int32_t new_uv = output_uv(dvs, target_uv);
+	bool raise;
+	int ret;
+
+	/* The boost voltage may also be written by other means, e.g. a power profile or a ramp.
+	 * It is cached by the regulator driver, so this needs no bus access in steady state.
+	 */
+	ret = regulator_npm2100_get_voltage(dvs->dev, NPM2100_SOURCE_BOOST, &dvs->programmed_uv);
+	if (ret < 0) {
+		return ret;
+	}
+
+	/* Wait for VOUT OK only when raised above the output last reported OK */
+	raise = new_uv > dvs->settled_uv;
+
+	if (new_uv == output_uv(dvs, dvs->programmed_uv)) {
+		/* Nothing to write, the boost holds the target or passes VBAT through either way.
+		 * Only a raise written earlier to this output still waits for VOUT OK.
+		 */
+		dvs->settling = dvs->settling && raise;
+	} else {
+		/* A VOUT OK latched before the write belongs to an earlier change */
+		if (raise) {
+			ret = mfd_npm2100_clear_events(dvs->dev, BIT(NPM2100_EVENT_BOOST_VOUT_OK));
+			if (ret < 0) {
+				return ret;
+			}
+		}
+
+		ret = regulator_npm2100_set_voltage(dvs->dev, NPM2100_SOURCE_BOOST, target_uv,
+						    target_uv);
+		if (ret < 0) {
+			return ret;
+		}
+
+		dvs->programmed_uv = target_uv;
+		dvs->transitions++;
+		dvs->settling = raise;
+	}
+
+	/* A lowered output is OK at once */
+	if (!dvs->settling) {
+		dvs->settled_uv = new_uv;
+	}
+
+	return 0;
+}
+
+int dvs_npm2100_init(struct dvs_npm2100 *dvs, struct i2c_dev *dev,
+		     const struct dvs_npm2100_config *config, uint8_t load)
+{
+	int ret;
+
+	if (load >= config->load_count) {
+		return -EINVAL;
+	}
+
+	dvs->dev = dev;
+	dvs->config = config;
+	dvs->load = load;
+	dvs->settling = false;
+	dvs->vbat_uv = 0;
+	dvs->transitions = 0U;
+	dvs->last_ms = clock_get_ms();
+	dvs->elapsed_ms = 0U;
+	dvs->saved_nj = 0U;
+
+	ret = mfd_npm2100_enable_events(dev, BIT(NPM2100_EVENT_BOOST_VOUT_OK));
+	if (ret < 0) {
+		return ret;
+	}
+
+	/* The output the boost is running at is taken as OK, only a raise above it waits */
+	ret = regulator_npm2100_get_voltage(dev, NPM2100_SOURCE_BOOST, &dvs->programmed_uv);
+	if (ret < 0) {
+		return ret;
+	}
+
+	dvs->settled_uv = dvs->programmed_uv;
+
+	return program(dvs);
+}
+
+int dvs_npm2100_set_load(struct dvs_npm2100 *dvs, uint8_t load)
+{
+	if (load >= dvs->config->load_count) {
+		return -EINVAL;
+	}
+
+	account(dvs);
+	dvs->load = load;
+
+	return program(dvs);
+}
+
+int dvs_npm2100_set_vbat(struct dvs_npm2100 *dvs, int32_t vbat_uv)
+{
+	account(dvs);
+	dvs->vbat_uv = vbat_uv;
+
+	/* A change skipped while passing through may be needed now */
+	return program(dvs);
+}
+
+bool dvs_npm2100_ready(const struct dvs_npm2100 *dvs)
+{
+	return !dvs->settling;
+}
+
+void dvs_npm2100_process_events(struct dvs_npm2100 *dvs, uint32_t events)
+{
+	if (((events & BIT(NPM2100_EVENT_BOOST_VOUT_OK)) == 0U) || !dvs->settling) {
+		return;
+	}
+
+	dvs->settling = false;
+	dvs->settled_uv = output_uv(dvs, dvs->programmed_uv);
+
+	if (dvs->config->ready != NULL) {
+		dvs->config->ready(dvs, dvs->config->user_data);
+	}
+}
+
+void dvs_npm2100_get_stats(struct dvs_npm2100 *dvs, struct dvs_npm2100_stats *stats)
+{
+	account(dvs);
+
+	stats->output_uv = output_uv(dvs, dvs->programmed_uv);
+	stats->transitions = dvs->transitions;
+	stats->saved_uj_per_hour =
+		(dvs->elapsed_ms == 0U)
+			? 0U
+			: (uint32_t)(dvs->saved_nj * 3600U / dvs->elapsed_ms);
+}
@@ -0,0 +1,135 @@
+/** @file
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef DVS_NPM2100_H_
+#define DVS_NPM2100_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "i2c.h"
+
+struct dvs_npm2100;
+
+/**
+ * @brief Load state requirement
+ */
+struct dvs_npm2100_load {
+	int32_t min_uv;   /* lowest boost output voltage the load operates at */
+	uint32_t load_ua; /* average load current, used for the savings estimate */
+};
+
+/**
+ * @brief Boost voltage governor configuration
+ *
+ * The configuration can be declared const so it is placed in flash.
+ */
+struct dvs_npm2100_config {
+	/* requirement per application load state */
+	const struct dvs_npm2100_load *loads;
+	uint8_t load_count;
+	/* fixed boost output voltage used without the governor, for the savings estimate */
+	int32_t nominal_uv;
+	/* optional, called once a raised output voltage is reported OK */
+	void (*ready)(struct dvs_npm2100 *dvs, void *user_data);
+	/* user context passed to the hook */
+	void *user_data;
+};
+
+/**
+ * @brief Boost voltage governor statistics
+ */
+struct dvs_npm2100_stats {
+	int32_t output_uv;           /* current boost output voltage, VBAT when passing through */
+	uint32_t transitions;        /* boost voltage writes */
+	uint32_t saved_uj_per_hour;  /* estimated energy saved compared to the nominal voltage */
+};
+
+/**
+ * @brief Boost voltage governor
+ *
+ * Fields are private.
+ */
+struct dvs_npm2100 {
+	struct i2c_dev *dev;
+	const struct dvs_npm2100_config *config;
+	uint8_t load;
+	bool settling;
+	int32_t settled_uv;
+	int32_t programmed_uv;
+	int32_t vbat_uv;
+	uint32_t transitions;
+	uint32_t last_ms;
+	uint32_t elapsed_ms;
+	uint64_t saved_nj;
+};
+
+/**
+ * @brief Initialise boost voltage governor
+ *
+ * Enables the boost VOUT OK event, and programs the voltage for @p load. The voltage the boost
+ * is running at is taken as reported OK, so only a raise above it waits for VOUT OK.
+ *
+ * @param dvs boost voltage governor.
+ * @param dev device pointer, passed to i2c hal layer.
+ * @param config load states.
+ * @param load initial load state.
+ * @return 0 on success, -EINVAL if a load state is out of range, -errno on bus failure
+ */
+int dvs_npm2100_init(struct dvs_npm2100 *dvs, struct i2c_dev *dev,
+		     const struct dvs_npm2100_config *config, uint8_t load);
+
+/**
+ * @brief Set application load state
+ *
+ * Programs the lowest boost voltage that satisfies the load. Lowering is immediate. When the
+ * voltage is raised, the load must wait until dvs_npm2100_ready returns true or the ready hook
+ * is called. Every request replaces the previous one, a raise still waiting for VOUT OK ends
+ * when followed by a voltage that was already reported OK. No bus access is made if the output
+ * voltage would not change, e.g. when the boost already holds it or passes VBAT through.
+ *
+ * @param dvs boost voltage governor.
+ * @param load load state.
+ * @return 0 on success, -EINVAL if the load state is out of range, -errno on bus failure
+ */
+int dvs_npm2100_set_load(struct dvs_npm2100 *dvs, uint8_t load);
+
+/**
+ * @brief Update battery voltage
+ *
+ * The boost output cannot fall below VBAT, so voltage changes below VBAT are skipped until
+ * VBAT drops.
+ *
+ * @param dvs boost voltage governor.
+ * @param vbat_uv battery voltage in uV, e.g. from adc_npm2100_get_result.
+ * @return 0 on success, -errno on bus failure
+ */
+int dvs_npm2100_set_vbat(struct dvs_npm2100 *dvs, int32_t vbat_uv);
+
+/**
+ * @brief Check whether the output voltage satisfies the current load state
+ *
+ * @param dvs boost voltage governor.
+ * @return true if ready
+ */
+bool dvs_npm2100_ready(const struct dvs_npm2100 *dvs);
+
+/**
+ * @brief Process events
+ *
+ * @param dvs boost voltage governor.
+ * @param events bitfield of events, as returned by mfd_npm2100_process_events
+ */
+void dvs_npm2100_process_events(struct dvs_npm2100 *dvs, uint32_t events);
+
+/**
+ * @brief Get boost voltage governor statistics
+ *
+ * @param dvs boost voltage governor.
+ * @param[out] stats Where statistics will be stored.
+ */
+void dvs_npm2100_get_stats(struct dvs_npm2100 *dvs, struct dvs_npm2100_stats *stats);
+
+#endif /* DVS_NPM2100_H_ */
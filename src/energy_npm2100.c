@@ -0,0 +1,168 @@
+/** @file
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "clock.h"
+#include "energy_npm2100.h"
+#include "i2c.h"
+#include "regulator_npm2100.h"
+#include "util.h"
+
+static enum energy_npm2100_mode mode_index(const struct energy_npm2100 *energy, unsigned int source)
+{
+	uint16_t mode = energy->mode[source];
+
+	if (!energy->enabled[source]) {
+		return ENERGY_NPM2100_MODE_OFF;
+	}
+
+	if ((source == NPM2100_SOURCE_LDOSW) && ((mode & NPM2100_REG_LDSW_EN) != 0U)) {
+		return ENERGY_NPM2100_MODE_LOADSW;
+	}
+
+	/* Pin forced modes are accounted in the mode used while the pin is inactive */
+	return (enum energy_npm2100_mode)FIELD_GET(NPM2100_REG_OPER_MASK, mode);
+}
+
+/* Accumulate time and charge since the last update, in the current modes */
+static void account(struct energy_npm2100 *energy)
+{
+	uint32_t now = clock_get_ms();
+	uint32_t elapsed = now - energy->last_ms;
+
+	energy->last_ms = now;
+
+	for (unsigned int i = 0U; i < ENERGY_NPM2100_SOURCES; i++) {
+		enum energy_npm2100_mode mode = mode_index(energy, i);
+		const struct energy_npm2100_cost *cost = &energy->config->cost[i][mode];
+		uint64_t current_na = cost->iq_na;
+
+		/* Load power drawn from the battery, through the conversion efficiency */
+		if ((mode != ENERGY_NPM2100_MODE_OFF) && (cost->eff_permille != 0U) &&
+		    (energy->vbat_uv > 0) && (energy->volt_uv[i] > 0)) {
+			current_na += (uint64_t)energy->load_ua[i] * (uint32_t)energy->volt_uv[i] *
+				      1000000U /
+				      ((uint64_t)(uint32_t)energy->vbat_uv * cost->eff_permille);
+		}
+
+		energy->time_ms[i][mode] += elapsed;
+		/* nA * ms is pC */
+		energy->charge_pc[i][mode] += current_na * elapsed;
+	}
+}
+
+static void changed(struct i2c_dev *dev, enum npm2100_regulator_source source,
+		    enum regulator_npm2100_change change, int32_t value, void *user_data)
+{
+	struct energy_npm2100 *energy = user_data;
+
+	(void)dev;
+
+	if (source >= ENERGY_NPM2100_SOURCES) {
+		return;
+	}
+
+	account(energy);
+
+	switch (change) {
+	case REGULATOR_NPM2100_CHANGE_MODE:
+		energy->mode[source] = (uint16_t)value;
+		break;
+	case REGULATOR_NPM2100_CHANGE_VOLTAGE:
+		energy->volt_uv[source] = value;
+		break;
+	case REGULATOR_NPM2100_CHANGE_ENABLE:
+		energy->enabled[source] = (value != 0);
+		break;
+	default:
+		break;
+	}
+}
+
+int energy_npm2100_init(struct energy_npm2100 *energy, struct i2c_dev *dev,
+			const struct energy_npm2100_config *config)
+{
+	energy->config = config;
+	energy->vbat_uv = 0;
+
+	for (unsigned int i = 0U; i < ENERGY_NPM2100_SOURCES; i++) {
+		int ret;
+
+		/* Start from the settings in effect */
+		ret = regulator_npm2100_get_mode(dev, i, &energy->mode[i]);
+		if (ret < 0) {
+			return ret;
+		}
+
+		ret = regulator_npm2100_get_voltage(dev, i, &energy->volt_uv[i]);
+		if (ret < 0) {
+			return ret;
+		}
+
+		ret = regulator_npm2100_is_enabled(dev, i, &energy->enabled[i]);
+		if (ret < 0) {
+			return ret;
+		}
+
+		energy->load_ua[i] = 0U;
+
+		for (unsigned int j = 0U; j < ENERGY_NPM2100_MODE_COUNT; j++) {
+			energy->time_ms[i][j] = 0U;
+			energy->charge_pc[i][j] = 0U;
+		}
+	}
+
+	energy->last_ms = clock_get_ms();
+
+	energy->listener.changed = changed;
+	energy->listener.user_data = energy;
+	regulator_npm2100_add_listener(&energy->listener);
+
+	return 0;
+}
+
+void energy_npm2100_set_load(struct energy_npm2100 *energy, enum npm2100_regulator_source source,
+			     uint32_t load_ua)
+{
+	if (source >= ENERGY_NPM2100_SOURCES) {
+		return;
+	}
+
+	account(energy);
+	energy->load_ua[source] = load_ua;
+}
+
+void energy_npm2100_set_vbat(struct energy_npm2100 *energy, int32_t vbat_uv)
+{
+	account(energy);
+	energy->vbat_uv = vbat_uv;
+}
+
+void energy_npm2100_get_usage(struct energy_npm2100 *energy, enum npm2100_regulator_source source,
+			      enum energy_npm2100_mode mode, struct energy_npm2100_usage *usage)
+{
+	account(energy);
+
+	usage->time_ms = energy->time_ms[source][mode];
+	usage->charge_uc = energy->charge_pc[source][mode] / 1000000U;
+}
+
+uint64_t energy_npm2100_get_charge_uc(struct energy_npm2100 *energy)
+{
+	uint64_t charge_pc = 0U;
+
+	account(energy);
+
+	for (unsigned int i = 0U; i < ENERGY_NPM2100_SOURCES; i++) {
+		for (unsigned int j = 0U; j < ENERGY_NPM2100_MODE_COUNT; j++) {
+			charge_pc += energy->charge_pc[i][j];
+		}
+	}
+
+	return charge_pc / 1000000U;
+}
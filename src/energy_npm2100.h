@@ -0,0 +1,134 @@
+/** @file
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef ENERGY_NPM2100_H_
+#define ENERGY_NPM2100_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "i2c.h"
+#include "regulator_npm2100.h"
+
+/* Number of regulator sources accounted */
+#define ENERGY_NPM2100_SOURCES 2U
+
+/**
+ * @brief Accounted operating modes
+ *
+ * The first entries follow the NPM2100_REG_OPER_ encoding.
+ */
+enum energy_npm2100_mode {
+	ENERGY_NPM2100_MODE_AUTO,
+	ENERGY_NPM2100_MODE_HP,
+	ENERGY_NPM2100_MODE_LP,
+	ENERGY_NPM2100_MODE_ULP,
+	ENERGY_NPM2100_MODE_PASS,
+	ENERGY_NPM2100_MODE_NOHP,
+	ENERGY_NPM2100_MODE_OFF,
+	/* LDOSW enabled as load switch, NPM2100_REG_LDSW_EN */
+	ENERGY_NPM2100_MODE_LOADSW,
+	ENERGY_NPM2100_MODE_COUNT,
+};
+
+/**
+ * @brief Cost of a regulator operating mode
+ */
+struct energy_npm2100_cost {
+	uint32_t iq_na;         /* quiescent current drawn from the battery */
+	uint16_t eff_permille;  /* efficiency from battery to regulator output, 0 for no load */
+};
+
+/**
+ * @brief Energy accounting configuration
+ *
+ * The configuration can be declared const so it is placed in flash.
+ */
+struct energy_npm2100_config {
+	struct energy_npm2100_cost cost[ENERGY_NPM2100_SOURCES][ENERGY_NPM2100_MODE_COUNT];
+};
+
+/**
+ * @brief Usage of one regulator mode
+ */
+struct energy_npm2100_usage {
+	uint64_t time_ms;   /* time spent in the mode */
+	uint64_t charge_uc; /* estimated battery charge drawn in the mode */
+};
+
+/**
+ * @brief Energy accounting
+ *
+ * Tracks the time each regulator spends in each mode, and estimates the battery charge drawn
+ * as quiescent current plus the load power divided by efficiency and battery voltage. Fields
+ * are private.
+ */
+struct energy_npm2100 {
+	const struct energy_npm2100_config *config;
+	struct regulator_npm2100_listener listener;
+	uint16_t mode[ENERGY_NPM2100_SOURCES];
+	bool enabled[ENERGY_NPM2100_SOURCES];
+	int32_t volt_uv[ENERGY_NPM2100_SOURCES];
+	uint32_t load_ua[ENERGY_NPM2100_SOURCES];
+	int32_t vbat_uv;
+	uint32_t last_ms;
+	uint64_t time_ms[ENERGY_NPM2100_SOURCES][ENERGY_NPM2100_MODE_COUNT];
+	uint64_t charge_pc[ENERGY_NPM2100_SOURCES][ENERGY_NPM2100_MODE_COUNT];
+};
+
+/**
+ * @brief Initialise energy accounting
+ *
+ * Reads the mode, voltage and enable state of both regulators, and registers as regulator
+ * listener to follow later changes.
+ *
+ * @param energy energy accounting.
+ * @param dev device pointer, passed to i2c hal layer.
+ * @param config mode costs.
+ * @return 0 on success, -errno on bus failure
+ */
+int energy_npm2100_init(struct energy_npm2100 *energy, struct i2c_dev *dev,
+			const struct energy_npm2100_config *config);
+
+/**
+ * @brief Set the load current of a regulator
+ *
+ * @param energy energy accounting.
+ * @param source regulator source identifier.
+ * @param load_ua average load current.
+ */
+void energy_npm2100_set_load(struct energy_npm2100 *energy, enum npm2100_regulator_source source,
+			     uint32_t load_ua);
+
+/**
+ * @brief Set the battery voltage
+ *
+ * Load charge is not accounted until a battery voltage is set.
+ *
+ * @param energy energy accounting.
+ * @param vbat_uv battery voltage.
+ */
+void energy_npm2100_set_vbat(struct energy_npm2100 *energy, int32_t vbat_uv);
+
+/**
+ * @brief Get usage of a regulator mode
+ *
+ * @param energy energy accounting.
+ * @param source regulator source identifier.
+ * @param mode operating mode.
+ * @param[out] usage Where time and charge will be stored.
+ */
+void energy_npm2100_get_usage(struct energy_npm2100 *energy, enum npm2100_regulator_source source,
+			      enum energy_npm2100_mode mode, struct energy_npm2100_usage *usage);
+
+/**
+ * @brief Get total battery charge drawn by both regulators
+ *
+ * @param energy energy accounting.
+ * @return Estimated charge in uC
+ */
+uint64_t energy_npm2100_get_charge_uc(struct energy_npm2100 *energy);
+
+#endif /* ENERGY_NPM2100_H_ */
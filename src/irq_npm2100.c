@@ -0,0 +1,136 @@
+/** @file
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "clock.h"
+#include "i2c.h"
+#include "irq_npm2100.h"
+#include "latency_npm2100.h"
+#include "mfd_npm2100.h"
+#include "stats_npm2100.h"
+
+/* Maximum number of event reads per call while the interrupt line stays asserted */
+#define IRQ_READS_MAX 4U
+
+void irq_npm2100_init(struct irq_npm2100 *irq, struct i2c_dev *dev,
+		      const struct irq_npm2100_config *config)
+{
+	irq->dev = dev;
+	irq->config = config;
+	irq->notified = 0U;
+	irq->notified_us = 0U;
+	irq->handled = 0U;
+	irq->coalesced = 0U;
+	irq->reads = 0U;
+}
+
+void irq_npm2100_notify(struct irq_npm2100 *irq)
+{
+	irq->notified_us = clock_get_us();
+
+	if (irq->config->disarm != NULL) {
+		irq->config->disarm(irq->config->user_data);
+	}
+
+	irq->notified++;
+}
+
+uint32_t irq_npm2100_notify_time_us(const struct irq_npm2100 *irq)
+{
+	return irq->notified_us;
+}
+
+bool irq_npm2100_pending(const struct irq_npm2100 *irq)
+{
+	return irq->notified != irq->handled;
+}
+
+int irq_npm2100_process(struct irq_npm2100 *irq, uint32_t *events)
+{
+	const struct irq_npm2100_config *config = irq->config;
+	uint32_t notified = irq->notified;
+	uint32_t edge_us = irq->notified_us;
+	uint32_t processed = 0U;
+	int ret = 0;
+
+	if (notified == irq->handled) {
+		if (events != NULL) {
+			*events = 0U;
+		}
+		return 0;
+	}
+
+	for (uint32_t i = 0U; i < IRQ_READS_MAX; i++) {
+		uint32_t read_us = clock_get_us();
+		uint32_t read_end_us;
+		uint32_t active;
+
+		ret = mfd_npm2100_process_events(irq->dev, &active);
+		if (ret < 0) {
+			break;
+		}
+
+		read_end_us = clock_get_us();
+
+		irq->reads++;
+		processed |= active;
+
+		/* The pin is disarmed, so events found by a repeated read raised no notification */
+		if ((i > 0U) && (active != 0U)) {
+			irq->coalesced++;
+		}
+
+		if (config->stats != NULL) {
+			stats_npm2100_record(config->stats, active, clock_get_ms());
+		}
+
+		if (config->callbacks != NULL) {
+			mfd_npm2100_dispatch_events(irq->dev, config->callbacks, active);
+		}
+
+		if (config->latency != NULL) {
+			uint32_t dispatch_end_us = clock_get_us();
+
+			latency_npm2100_record(config->latency, active, edge_us, read_us,
+					       read_end_us, dispatch_end_us);
+
+			/* Events found by a repeated read have no pin edge of their own,
+			 * measure them from the end of this dispatch
+			 */
+			edge_us = dispatch_end_us;
+		}
+
+		/* Events raised during processing keep the interrupt line asserted */
+		if ((config->pin_active == NULL) || !config->pin_active(config->user_data)) {
+			break;
+		}
+	}
+
+	/* Mark as handled before re-arming, so a notification raised by the re-armed pin is
+	 * not lost. On bus error the pin is re-armed as well: a still asserted level-triggered
+	 * line will notify again and processing is retried.
+	 */
+	irq->handled = notified;
+
+	if (config->arm != NULL) {
+		config->arm(config->user_data);
+	}
+
+	if (events != NULL) {
+		*events = processed;
+	}
+
+	return ret;
+}
+
+void irq_npm2100_get_stats(const struct irq_npm2100 *irq, struct irq_npm2100_stats *stats)
+{
+	stats->notifications = irq->notified;
+	stats->coalesced = irq->coalesced;
+	stats->reads = irq->reads;
+}
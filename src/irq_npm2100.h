@@ -0,0 +1,125 @@
+/** @file
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef IRQ_NPM2100_H_
+#define IRQ_NPM2100_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "i2c.h"
+#include "latency_npm2100.h"
+#include "mfd_npm2100.h"
+#include "stats_npm2100.h"
+
+/**
+ * @brief Host interrupt pin hooks and event handlers
+ *
+ * The configuration can be declared const so it is placed in flash.
+ */
+struct irq_npm2100_config {
+	/* optional event callback table, see mfd_npm2100_dispatch_events */
+	const struct mfd_npm2100_event_callback *callbacks;
+	/* optional event statistics, fed with every event read */
+	struct stats_npm2100 *stats;
+	/* optional interrupt latency instrumentation, fed with every event read */
+	struct latency_npm2100 *latency;
+	/* optional, disable the host pin interrupt, called from irq_npm2100_notify */
+	void (*disarm)(void *user_data);
+	/* optional, re-enable the host pin interrupt, called once processing is done */
+	void (*arm)(void *user_data);
+	/* optional, return true while the nPM2100 interrupt line is asserted */
+	bool (*pin_active)(void *user_data);
+	/* user context passed to the hooks */
+	void *user_data;
+};
+
+/**
+ * @brief Deferred interrupt processing statistics
+ */
+struct irq_npm2100_stats {
+	uint32_t notifications; /* interrupt notifications received */
+	uint32_t coalesced;     /* repeated reads finding events while the line stayed asserted */
+	uint32_t reads;         /* event register reads issued */
+};
+
+/**
+ * @brief Deferred interrupt processing instance
+ *
+ * Fields are private, use the irq_npm2100 functions to access them.
+ */
+struct irq_npm2100 {
+	struct i2c_dev *dev;
+	const struct irq_npm2100_config *config;
+	/* only written by irq_npm2100_notify */
+	volatile uint32_t notified;
+	volatile uint32_t notified_us;
+	/* only written by irq_npm2100_process */
+	uint32_t handled;
+	uint32_t coalesced;
+	uint32_t reads;
+};
+
+/**
+ * @brief Initialise deferred interrupt processing
+ *
+ * @param irq instance to initialise.
+ * @param dev device pointer, passed to i2c hal layer.
+ * @param config host pin hooks and event handlers.
+ */
+void irq_npm2100_init(struct irq_npm2100 *irq, struct i2c_dev *dev,
+		      const struct irq_npm2100_config *config);
+
+/**
+ * @brief Notify that the nPM2100 interrupt line was asserted
+ *
+ * To be called from the host pin interrupt handler. Disarms the host pin and queues the
+ * notification, no bus access is made. Must always be called from the same interrupt priority.
+ *
+ * @param irq deferred interrupt processing instance.
+ */
+void irq_npm2100_notify(struct irq_npm2100 *irq);
+
+/**
+ * @brief Get time of the latest interrupt notification
+ *
+ * @param irq deferred interrupt processing instance.
+ * @return clock_get_us time taken in irq_npm2100_notify
+ */
+uint32_t irq_npm2100_notify_time_us(const struct irq_npm2100 *irq);
+
+/**
+ * @brief Check whether interrupt notifications are waiting to be processed
+ *
+ * @param irq deferred interrupt processing instance.
+ * @return true if irq_npm2100_process should be called
+ */
+bool irq_npm2100_pending(const struct irq_npm2100 *irq);
+
+/**
+ * @brief Process queued interrupt notifications
+ *
+ * To be called from thread or main loop context. All queued notifications are served by one
+ * call to mfd_npm2100_process_events, and the active events are recorded in the statistics and
+ * dispatched to the registered handlers. If the interrupt line is still asserted afterwards,
+ * events are read again before the host pin is re-armed. Returns immediately if nothing is
+ * pending.
+ *
+ * @param irq deferred interrupt processing instance.
+ * @param[out] events optional, bitfield of all events processed (bits are defined by
+ * mfd_npm2100_event_t)
+ * @return 0 on success, -errno on failure
+ */
+int irq_npm2100_process(struct irq_npm2100 *irq, uint32_t *events);
+
+/**
+ * @brief Get deferred interrupt processing statistics
+ *
+ * @param irq deferred interrupt processing instance.
+ * @param[out] stats Where statistics will be stored.
+ */
+void irq_npm2100_get_stats(const struct irq_npm2100 *irq, struct irq_npm2100_stats *stats);
+
+#endif /* IRQ_NPM2100_H_ */
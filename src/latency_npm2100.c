@@ -0,0 +1,127 @@
+/** @file
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "latency_npm2100.h"
+#include "math_extras.h"
+#include "mfd_npm2100.h"
+#include "util.h"
+
+/*
+ * Buckets 0 and 1 hold 0 and 1 us. Above that, each power of two 2^e is split in two buckets,
+ * [2^e, 1.5 * 2^e) and [1.5 * 2^e, 2^(e+1)), at index 2e and 2e + 1.
+ */
+static inline uint32_t bucket_index(uint32_t us)
+{
+	uint32_t e;
+
+	if (us < 2U) {
+		return us;
+	}
+
+	e = 31U - u32_count_leading_zeros(us);
+
+	return MIN(2U * e + ((us >> (e - 1U)) & 1U), LATENCY_NPM2100_BUCKETS - 1U);
+}
+
+/* Largest value counted in a bucket */
+static inline uint32_t bucket_limit(uint32_t idx)
+{
+	uint32_t e = idx / 2U;
+
+	if (idx < 2U) {
+		return idx;
+	}
+
+	return (idx & 1U) ? BIT(e + 1U) - 1U : BIT(e) + BIT(e - 1U) - 1U;
+}
+
+static void hist_record(struct latency_npm2100_hist *hist, uint32_t us)
+{
+	uint16_t *bucket = &hist->bucket[bucket_index(us)];
+
+	if (*bucket < UINT16_MAX) {
+		(*bucket)++;
+	}
+
+	if (us > hist->max_us) {
+		hist->max_us = us;
+	}
+}
+
+static void hist_summary(const struct latency_npm2100_hist *hist,
+			 struct latency_npm2100_summary *summary)
+{
+	uint32_t p50 = 0U;
+	uint32_t p99 = 0U;
+	uint32_t sum = 0U;
+
+	summary->count = 0U;
+	for (uint32_t i = 0U; i < LATENCY_NPM2100_BUCKETS; i++) {
+		summary->count += hist->bucket[i];
+	}
+
+	/* Number of samples at or below each percentile, rounded up */
+	p50 = DIV_ROUND_UP(summary->count * 50U, 100U);
+	p99 = DIV_ROUND_UP(summary->count * 99U, 100U);
+
+	summary->p50_us = 0U;
+	summary->p99_us = 0U;
+	summary->max_us = hist->max_us;
+
+	for (uint32_t i = 0U; i < LATENCY_NPM2100_BUCKETS; i++) {
+		uint32_t prev = sum;
+
+		sum += hist->bucket[i];
+		if ((prev < p50) && (sum >= p50)) {
+			summary->p50_us = MIN(bucket_limit(i), hist->max_us);
+		}
+		if ((prev < p99) && (sum >= p99)) {
+			summary->p99_us = MIN(bucket_limit(i), hist->max_us);
+			break;
+		}
+	}
+}
+
+void latency_npm2100_init(struct latency_npm2100 *latency, uint32_t events)
+{
+	memset(latency, 0, sizeof(*latency));
+	latency->events = events & BIT_MASK(NPM2100_EVENT_MAX);
+}
+
+void latency_npm2100_record(struct latency_npm2100 *latency, uint32_t events, uint32_t edge_us,
+			    uint32_t read_us, uint32_t read_end_us, uint32_t dispatch_end_us)
+{
+	uint32_t total = dispatch_end_us - edge_us;
+
+	hist_record(&latency->stage[LATENCY_NPM2100_STAGE_WAIT], read_us - edge_us);
+	hist_record(&latency->stage[LATENCY_NPM2100_STAGE_BUS], read_end_us - read_us);
+	hist_record(&latency->stage[LATENCY_NPM2100_STAGE_DISPATCH], dispatch_end_us - read_end_us);
+
+	events &= latency->events;
+
+	while (events != 0U) {
+		hist_record(&latency->event[u32_count_trailing_zeros(events)], total);
+
+		/* Clear lowest set bit */
+		events &= events - 1U;
+	}
+}
+
+void latency_npm2100_get_stage(const struct latency_npm2100 *latency,
+			       enum latency_npm2100_stage stage,
+			       struct latency_npm2100_summary *summary)
+{
+	hist_summary(&latency->stage[stage], summary);
+}
+
+void latency_npm2100_get_event(const struct latency_npm2100 *latency,
+			       enum mfd_npm2100_event_t event,
+			       struct latency_npm2100_summary *summary)
+{
+	hist_summary(&latency->event[event], summary);
+}
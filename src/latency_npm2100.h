@@ -0,0 +1,104 @@
+/** @file
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef LATENCY_NPM2100_H_
+#define LATENCY_NPM2100_H_
+
+#include <stdint.h>
+
+#include "mfd_npm2100.h"
+
+/* Histogram buckets, two per power of two, the last one also counts everything above 1 s */
+#define LATENCY_NPM2100_BUCKETS 40U
+
+/**
+ * @brief Interrupt path stages
+ */
+enum latency_npm2100_stage {
+	/* host pin edge to start of the event register read */
+	LATENCY_NPM2100_STAGE_WAIT,
+	/* event register read and clear */
+	LATENCY_NPM2100_STAGE_BUS,
+	/* event handler dispatch */
+	LATENCY_NPM2100_STAGE_DISPATCH,
+	LATENCY_NPM2100_STAGE_COUNT,
+};
+
+/**
+ * @brief Latency histogram
+ */
+struct latency_npm2100_hist {
+	uint32_t max_us;
+	uint16_t bucket[LATENCY_NPM2100_BUCKETS];
+};
+
+/**
+ * @brief Latency histogram summary
+ */
+struct latency_npm2100_summary {
+	uint32_t count;  /* number of samples */
+	uint32_t p50_us; /* median, upper bound of its bucket */
+	uint32_t p99_us; /* 99th percentile, upper bound of its bucket */
+	uint32_t max_us; /* largest sample */
+};
+
+/**
+ * @brief Interrupt latency instrumentation
+ *
+ * Keeps a histogram per interrupt path stage, and one per event of the time from host pin
+ * edge to the end of dispatch. Bucket counts saturate at UINT16_MAX.
+ */
+struct latency_npm2100 {
+	uint32_t events;
+	struct latency_npm2100_hist stage[LATENCY_NPM2100_STAGE_COUNT];
+	struct latency_npm2100_hist event[NPM2100_EVENT_MAX];
+};
+
+/**
+ * @brief Initialise latency instrumentation
+ *
+ * @param latency latency instrumentation to clear.
+ * @param events bitfield of events to record (bits are defined by mfd_npm2100_event_t)
+ */
+void latency_npm2100_init(struct latency_npm2100 *latency, uint32_t events);
+
+/**
+ * @brief Record latency of one event read
+ *
+ * All timestamps are clock_get_us times.
+ *
+ * @param latency latency instrumentation.
+ * @param events bitfield of events active in the read.
+ * @param edge_us time of the host pin edge.
+ * @param read_us time the event register read started.
+ * @param read_end_us time the event register read and clear completed.
+ * @param dispatch_end_us time the event handlers returned.
+ */
+void latency_npm2100_record(struct latency_npm2100 *latency, uint32_t events, uint32_t edge_us,
+			    uint32_t read_us, uint32_t read_end_us, uint32_t dispatch_end_us);
+
+/**
+ * @brief Summarise interrupt path stage latency
+ *
+ * @param latency latency instrumentation.
+ * @param stage interrupt path stage.
+ * @param[out] summary Where the summary will be stored.
+ */
+void latency_npm2100_get_stage(const struct latency_npm2100 *latency,
+			       enum latency_npm2100_stage stage,
+			       struct latency_npm2100_summary *summary);
+
+/**
+ * @brief Summarise latency from host pin edge to end of dispatch for an event
+ *
+ * @param latency latency instrumentation.
+ * @param event event identifier.
+ * @param[out] summary Where the summary will be stored.
+ */
+void latency_npm2100_get_event(const struct latency_npm2100 *latency,
+			       enum mfd_npm2100_event_t event,
+			       struct latency_npm2100_summary *summary);
+
+#endif /* LATENCY_NPM2100_H_ */
@@ -0,0 +1,164 @@
+/** @file
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "clock.h"
+#include "i2c.h"
+#include "ldosw_npm2100.h"
+#include "mfd_npm2100.h"
+#include "regulator_npm2100.h"
+#include "util.h"
+#include "vtimer_npm2100.h"
+
+#define LDOSW_FAULT_EVENTS (BIT(NPM2100_EVENT_LDOSW_OCP) | BIT(NPM2100_EVENT_LDOSW_VINTFAIL))
+
+/* Turn LDOSW back on, and account the time it was off */
+static int recover(struct ldosw_npm2100 *sup)
+{
+	uint32_t now;
+	int ret;
+
+	ret = regulator_npm2100_enable(sup->dev, NPM2100_SOURCE_LDOSW);
+	if (ret < 0) {
+		return ret;
+	}
+
+	now = clock_get_ms();
+	sup->downtime_ms += now - sup->down_ms;
+	sup->enabled_ms = now;
+	sup->down = false;
+
+	return 0;
+}
+
+static void retry_handler(struct vtimer_npm2100 *vt, struct vtimer_npm2100_timer *timer,
+			  void *user_data)
+{
+	struct ldosw_npm2100 *sup = user_data;
+
+	if (recover(sup) < 0) {
+		/* Bus failure, try again after the same delay */
+		if (vtimer_npm2100_start(vt, timer, sup->backoff_ms, retry_handler, sup) < 0) {
+			/* Left off, recoverable with ldosw_npm2100_reset */
+			sup->failed = true;
+		}
+		return;
+	}
+
+	sup->recoveries++;
+	sup->backoff_ms = MIN(sup->backoff_ms * 2U, sup->config->max_backoff_ms);
+}
+
+int ldosw_npm2100_init(struct ldosw_npm2100 *sup, struct i2c_dev *dev,
+		       const struct ldosw_npm2100_config *config, struct vtimer_npm2100 *vt)
+{
+	sup->dev = dev;
+	sup->config = config;
+	sup->vt = vt;
+	sup->timer = (struct vtimer_npm2100_timer){0};
+	sup->down = false;
+	sup->failed = false;
+	sup->attempts = 0U;
+	sup->backoff_ms = config->initial_backoff_ms;
+	sup->down_ms = 0U;
+	sup->enabled_ms = clock_get_ms();
+	sup->ocp = 0U;
+	sup->vintfail = 0U;
+	sup->recoveries = 0U;
+	sup->downtime_ms = 0U;
+
+	return mfd_npm2100_enable_events(dev, LDOSW_FAULT_EVENTS);
+}
+
+int ldosw_npm2100_process_events(struct ldosw_npm2100 *sup, uint32_t events)
+{
+	const struct ldosw_npm2100_config *config = sup->config;
+	uint32_t now;
+	int ret;
+
+	if ((events & LDOSW_FAULT_EVENTS) == 0U) {
+		return 0;
+	}
+
+	if ((events & BIT(NPM2100_EVENT_LDOSW_OCP)) != 0U) {
+		sup->ocp++;
+	}
+
+	if ((events & BIT(NPM2100_EVENT_LDOSW_VINTFAIL)) != 0U) {
+		sup->vintfail++;
+	}
+
+	/* A retry is already pending, or recovery was given up */
+	if (sup->down) {
+		return 0;
+	}
+
+	now = clock_get_ms();
+	sup->down = true;
+	sup->down_ms = now;
+
+	/* The previous recovery held long enough, the fault is a new one */
+	if (now - sup->enabled_ms >= config->stable_ms) {
+		sup->attempts = 0U;
+		sup->backoff_ms = config->initial_backoff_ms;
+	}
+
+	if (sup->attempts >= config->retries) {
+		sup->failed = true;
+
+		if (config->gave_up != NULL) {
+			config->gave_up(sup, config->user_data);
+		}
+
+		return 0;
+	}
+
+	sup->attempts++;
+
+	ret = vtimer_npm2100_start(sup->vt, &sup->timer, sup->backoff_ms, retry_handler, sup);
+	if (ret < 0) {
+		/* Left off, recoverable with ldosw_npm2100_reset */
+		sup->failed = true;
+	}
+
+	return ret;
+}
+
+int ldosw_npm2100_reset(struct ldosw_npm2100 *sup)
+{
+	int ret;
+
+	if (!sup->failed) {
+		return -EALREADY;
+	}
+
+	ret = recover(sup);
+	if (ret < 0) {
+		return ret;
+	}
+
+	sup->failed = false;
+	sup->attempts = 0U;
+	sup->backoff_ms = sup->config->initial_backoff_ms;
+
+	return 0;
+}
+
+void ldosw_npm2100_get_stats(const struct ldosw_npm2100 *sup, struct ldosw_npm2100_stats *stats)
+{
+	stats->ocp = sup->ocp;
+	stats->vintfail = sup->vintfail;
+	stats->recoveries = sup->recoveries;
+	stats->downtime_ms = sup->downtime_ms;
+	stats->failed = sup->failed;
+
+	if (sup->down) {
+		stats->downtime_ms += clock_get_ms() - sup->down_ms;
+	}
+}
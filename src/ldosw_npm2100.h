@@ -0,0 +1,116 @@
+/** @file
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef LDOSW_NPM2100_H_
+#define LDOSW_NPM2100_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "i2c.h"
+#include "vtimer_npm2100.h"
+
+struct ldosw_npm2100;
+
+/**
+ * @brief LDOSW fault supervisor configuration
+ *
+ * The configuration can be declared const so it is placed in flash.
+ */
+struct ldosw_npm2100_config {
+	/* delay before the first re-enable attempt, doubled on every further attempt */
+	uint32_t initial_backoff_ms;
+	/* longest delay between re-enable attempts */
+	uint32_t max_backoff_ms;
+	/* consecutive re-enable attempts before giving up */
+	uint8_t retries;
+	/* time without fault after a re-enable that restores the full retry budget */
+	uint32_t stable_ms;
+	/* optional, called when the retry budget is exhausted and LDOSW is left off */
+	void (*gave_up)(struct ldosw_npm2100 *sup, void *user_data);
+	/* user context passed to the hook */
+	void *user_data;
+};
+
+/**
+ * @brief LDOSW fault statistics
+ */
+struct ldosw_npm2100_stats {
+	uint32_t ocp;         /* over-current faults */
+	uint32_t vintfail;    /* internal supply faults */
+	uint32_t recoveries;  /* successful re-enables */
+	uint32_t downtime_ms; /* total time LDOSW was off due to faults, including the current one */
+	bool failed;          /* retry budget exhausted, LDOSW is left off */
+};
+
+/**
+ * @brief LDOSW fault supervisor
+ *
+ * Fields are private.
+ */
+struct ldosw_npm2100 {
+	struct i2c_dev *dev;
+	const struct ldosw_npm2100_config *config;
+	struct vtimer_npm2100 *vt;
+	struct vtimer_npm2100_timer timer;
+	bool down;
+	bool failed;
+	uint8_t attempts;
+	uint32_t backoff_ms;
+	uint32_t down_ms;
+	uint32_t enabled_ms;
+	uint32_t ocp;
+	uint32_t vintfail;
+	uint32_t recoveries;
+	uint32_t downtime_ms;
+};
+
+/**
+ * @brief Initialise LDOSW fault supervisor
+ *
+ * Enables the LDOSW OCP and VINTFAIL events. Re-enable attempts are scheduled on @p vt, which
+ * needs capacity for one more timer.
+ *
+ * @param sup LDOSW fault supervisor.
+ * @param dev device pointer, passed to i2c hal layer.
+ * @param config backoff and retry budget.
+ * @param vt virtual timer service.
+ * @return 0 on success, -errno on bus failure
+ */
+int ldosw_npm2100_init(struct ldosw_npm2100 *sup, struct i2c_dev *dev,
+		       const struct ldosw_npm2100_config *config, struct vtimer_npm2100 *vt);
+
+/**
+ * @brief Handle LDOSW fault events
+ *
+ * Should be called with every event bitfield returned by mfd_npm2100_process_events. Makes no
+ * bus access unless a fault occurred.
+ *
+ * @param sup LDOSW fault supervisor.
+ * @param events bitfield of events (bits are defined by mfd_npm2100_event_t).
+ * @return 0 on success, -ENOMEM if the re-enable timer could not be started, leaving LDOSW off
+ * until ldosw_npm2100_reset, -errno on failure
+ */
+int ldosw_npm2100_process_events(struct ldosw_npm2100 *sup, uint32_t events);
+
+/**
+ * @brief Re-enable LDOSW after recovery was given up
+ *
+ * Restores the full retry budget.
+ *
+ * @param sup LDOSW fault supervisor.
+ * @return 0 on success, -EALREADY if LDOSW was not given up, -errno on bus failure
+ */
+int ldosw_npm2100_reset(struct ldosw_npm2100 *sup);
+
+/**
+ * @brief Get LDOSW fault statistics
+ *
+ * @param sup LDOSW fault supervisor.
+ * @param[out] stats Where statistics will be stored.
+ */
+void ldosw_npm2100_get_stats(const struct ldosw_npm2100 *sup, struct ldosw_npm2100_stats *stats);
+
+#endif /* LDOSW_NPM2100_H_ */
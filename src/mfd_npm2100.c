@@ -7,6 +7,7 @@
 
 #include "byteorder.h"
 #include "i2c.h"
+#include "math_extras.h"
 #include "mfd_npm2100.h"
 #include "util.h"
 
@@ -15,6 +16,7 @@
 #define INTEN_SET         0x0AU
 #define INTEN_CLR         0x0FU
 #define TIMER_STATUS      0xB7U
+#define TIMER_BOOT_MON    0xB8U
 
 #define TIMER_TASKS_START       0xB0U
 #define TIMER_TASKS_STOP        0xB1U
@@ -26,9 +28,24 @@
 
 #define TIMER_STATUS_IDLE 0U
 
-#define TIMER_PRESCALER_MUL 64ULL
-#define TIMER_PRESCALER_DIV 1000ULL
-#define TIMER_MAX           0xFFFFFFU
+#define TIMER_MAX           NPM2100_TIMER_TICKS_MAX
+
+/* Timer ticks per ms as a reduced fraction */
+#define TIMER_PRESCALER_MUL 8U
+#define TIMER_PRESCALER_DIV 125U
+BUILD_ASSERT(NPM2100_TIMER_TICK_HZ * TIMER_PRESCALER_DIV == 1000U * TIMER_PRESCALER_MUL);
+
+/* Ticks per ms as a fixed point multiplier. The shift keeps the conversion exact for all ms
+ * values up to TIMER_MUL_MS_MAX, and the product within 64 bits for corrections up to
+ * TIMER_PPM_MAX.
+ */
+#define TIMER_MUL_SHIFT   38U
+#define TIMER_MUL_MS_MAX  BIT_MASK(29)
+#define TIMER_MUL_NOMINAL                                                                          \
+	(((1ULL << TIMER_MUL_SHIFT) * TIMER_PRESCALER_MUL + TIMER_PRESCALER_DIV / 2U) /            \
+	 TIMER_PRESCALER_DIV)
+#define TIMER_PPM_SCALE   1000000
+#define TIMER_PPM_MAX     100000
 
 #define EVENTS_SIZE 5U
 
@@ -61,41 +78,104 @@
 #define PWRBUTTON_MASK     0x04U
 #define PWRBUTTON_DISABLED 0x01U
 #define STROBE             0x01U
+#define BOOT_MON_ENABLE    0x01U
+
+/*
+ * Event register layout. The events of each register are contiguous in mfd_npm2100_event_t and
+ * occupy the low bits of the register, so each register decodes with one mask and one shift.
+ */
+#define EVENT_REG_SHIFT(n)                                                                         \
+	((n) == 0U   ? NPM2100_EVENT_SYS_DIETEMP_WARN                                              \
+	 : (n) == 1U ? NPM2100_EVENT_ADC_VBAT_READY                                                \
+	 : (n) == 2U ? NPM2100_EVENT_GPIO0_FALL                                                    \
+	 : (n) == 3U ? NPM2100_EVENT_BOOST_VBAT_WARN                                               \
+		     : NPM2100_EVENT_LDOSW_OCP)
+#define EVENT_REG_END(n)                                                                           \
+	(((n) + 1U < EVENTS_SIZE) ? EVENT_REG_SHIFT((n) + 1U) : NPM2100_EVENT_MAX)
+#define EVENT_REG_MASK(n) BIT_MASK(EVENT_REG_END(n) - EVENT_REG_SHIFT(n))
+
+#define EVENT_REG_DECODE(regs, n) (((uint32_t)(regs)[n] & EVENT_REG_MASK(n)) << EVENT_REG_SHIFT(n))
+#define EVENT_REG_ENCODE(events, n) (((events) >> EVENT_REG_SHIFT(n)) & EVENT_REG_MASK(n))
+
+/* Register offset and bit mask of each event, as documented in the register map */
+#define EVENT_REG_TABLE(FN)                                                                        \
+	FN(NPM2100_EVENT_SYS_DIETEMP_WARN, 0x00U, 0x01U)                                           \
+	FN(NPM2100_EVENT_SYS_SHIPHOLD_FALL, 0x00U, 0x02U)                                          \
+	FN(NPM2100_EVENT_SYS_SHIPHOLD_RISE, 0x00U, 0x04U)                                          \
+	FN(NPM2100_EVENT_SYS_PGRESET_FALL, 0x00U, 0x08U)                                           \
+	FN(NPM2100_EVENT_SYS_PGRESET_RISE, 0x00U, 0x10U)                                           \
+	FN(NPM2100_EVENT_SYS_TIMER_EXPIRY, 0x00U, 0x20U)                                           \
+	FN(NPM2100_EVENT_ADC_VBAT_READY, 0x01U, 0x01U)                                             \
+	FN(NPM2100_EVENT_ADC_DIETEMP_READY, 0x01U, 0x02U)                                          \
+	FN(NPM2100_EVENT_ADC_DROOP_DETECT, 0x01U, 0x04U)                                           \
+	FN(NPM2100_EVENT_ADC_VOUT_READY, 0x01U, 0x08U)                                             \
+	FN(NPM2100_EVENT_GPIO0_FALL, 0x02U, 0x01U)                                                 \
+	FN(NPM2100_EVENT_GPIO0_RISE, 0x02U, 0x02U)                                                 \
+	FN(NPM2100_EVENT_GPIO1_FALL, 0x02U, 0x04U)                                                 \
+	FN(NPM2100_EVENT_GPIO1_RISE, 0x02U, 0x08U)                                                 \
+	FN(NPM2100_EVENT_BOOST_VBAT_WARN, 0x03U, 0x01U)                                            \
+	FN(NPM2100_EVENT_BOOST_VOUT_MIN, 0x03U, 0x02U)                                             \
+	FN(NPM2100_EVENT_BOOST_VOUT_WARN, 0x03U, 0x04U)                                            \
+	FN(NPM2100_EVENT_BOOST_VOUT_DPS, 0x03U, 0x08U)                                             \
+	FN(NPM2100_EVENT_BOOST_VOUT_OK, 0x03U, 0x10U)                                              \
+	FN(NPM2100_EVENT_LDOSW_OCP, 0x04U, 0x01U)                                                  \
+	FN(NPM2100_EVENT_LDOSW_VINTFAIL, 0x04U, 0x02U)
+
+/* Check that the shift/mask decoder agrees with the register map for every event */
+#define EVENT_REG_CHECK(_event, _offset, _mask)                                                    \
+	BUILD_ASSERT(((_event) >= EVENT_REG_SHIFT(_offset)) &&                                     \
+			     ((_event) < EVENT_REG_END(_offset)) &&                                \
+			     ((_mask) == BIT((_event) - EVENT_REG_SHIFT(_offset))),                \
+		     "event decoder does not match register map for " #_event);
+#define EVENT_REG_COUNT(_event, _offset, _mask) +1
+
+EVENT_REG_TABLE(EVENT_REG_CHECK)
+BUILD_ASSERT((0 EVENT_REG_TABLE(EVENT_REG_COUNT)) == NPM2100_EVENT_MAX,
+	     "event register map does not cover all events");
+BUILD_ASSERT(EVENTS_SIZE == 5U, "event decoder is unrolled for 5 registers");
+
+/* Assemble event bitfield from the event registers */
+static inline uint32_t regs_to_events(const uint8_t regs[EVENTS_SIZE])
+{
+	return EVENT_REG_DECODE(regs, 0U) | EVENT_REG_DECODE(regs, 1U) |
+	       EVENT_REG_DECODE(regs, 2U) | EVENT_REG_DECODE(regs, 3U) |
+	       EVENT_REG_DECODE(regs, 4U);
+}
+
+static uint64_t timer_mul = TIMER_MUL_NOMINAL;
 
-struct event_reg_t {
-	uint8_t offset;
-	uint8_t mask;
-};
-
-static const struct event_reg_t event_reg[NPM2100_EVENT_MAX] = {
-	[NPM2100_EVENT_SYS_DIETEMP_WARN] = {0x00U, 0x01U},
-	[NPM2100_EVENT_SYS_SHIPHOLD_FALL] = {0x00U, 0x02U},
-	[NPM2100_EVENT_SYS_SHIPHOLD_RISE] = {0x00U, 0x04U},
-	[NPM2100_EVENT_SYS_PGRESET_FALL] = {0x00U, 0x08U},
-	[NPM2100_EVENT_SYS_PGRESET_RISE] = {0x00U, 0x10U},
-	[NPM2100_EVENT_SYS_TIMER_EXPIRY] = {0x00U, 0x20U},
-	[NPM2100_EVENT_ADC_VBAT_READY] = {0x01U, 0x01U},
-	[NPM2100_EVENT_ADC_DIETEMP_READY] = {0x01U, 0x02U},
-	[NPM2100_EVENT_ADC_DROOP_DETECT] = {0x01U, 0x04U},
-	[NPM2100_EVENT_ADC_VOUT_READY] = {0x01U, 0x08U},
-	[NPM2100_EVENT_GPIO0_FALL] = {0x02U, 0x01U},
-	[NPM2100_EVENT_GPIO0_RISE] = {0x02U, 0x02U},
-	[NPM2100_EVENT_GPIO1_FALL] = {0x02U, 0x04U},
-	[NPM2100_EVENT_GPIO1_RISE] = {0x02U, 0x08U},
-	[NPM2100_EVENT_BOOST_VBAT_WARN] = {0x03U, 0x01U},
-	[NPM2100_EVENT_BOOST_VOUT_MIN] = {0x03U, 0x02U},
-	[NPM2100_EVENT_BOOST_VOUT_WARN] = {0x03U, 0x04U},
-	[NPM2100_EVENT_BOOST_VOUT_DPS] = {0x03U, 0x08U},
-	[NPM2100_EVENT_BOOST_VOUT_OK] = {0x03U, 0x10U},
-	[NPM2100_EVENT_LDOSW_OCP] = {0x04U, 0x01U},
-	[NPM2100_EVENT_LDOSW_VINTFAIL] = {0x04U, 0x02U},
-};
+void mfd_npm2100_set_timer_ppm(int32_t ppm)
+{
+	uint64_t scale = TIMER_PPM_SCALE + CLAMP(ppm, -TIMER_PPM_MAX, TIMER_PPM_MAX);
+	uint64_t div = (uint64_t)TIMER_PRESCALER_DIV * TIMER_PPM_SCALE;
+
+	timer_mul = ((scale * TIMER_PRESCALER_MUL << TIMER_MUL_SHIFT) + div / 2U) / div;
+}
+
+uint32_t mfd_npm2100_timer_ms_to_ticks(uint32_t time_ms)
+{
+	if (time_ms > TIMER_MUL_MS_MAX) {
+		return UINT32_MAX;
+	}
+
+	return (time_ms * timer_mul + BIT64(TIMER_MUL_SHIFT - 1U)) >> TIMER_MUL_SHIFT;
+}
 
 int mfd_npm2100_set_timer(struct i2c_dev *dev, uint32_t time_ms, enum mfd_npm2100_timer_mode mode)
+{
+	uint32_t ticks = mfd_npm2100_timer_ms_to_ticks(time_ms);
+
+	if (ticks > TIMER_MAX) {
+		return -EINVAL;
+	}
+
+	return mfd_npm2100_set_timer_ticks(dev, ticks, mode);
+}
+
+int mfd_npm2100_set_timer_ticks(struct i2c_dev *dev, uint32_t ticks,
+				enum mfd_npm2100_timer_mode mode)
 {
 	uint8_t buff[4] = {TIMER_TARGET};
-	int64_t ticks = DIV_ROUND_CLOSEST(((int64_t)time_ms * TIMER_PRESCALER_MUL),
-						     TIMER_PRESCALER_DIV);
 	uint8_t timer_status;
 	int ret;
 
@@ -132,6 +212,20 @@ int mfd_npm2100_stop_timer(struct i2c_dev *dev)
 	return i2c_reg_write_byte(dev, TIMER_TASKS_STOP, 1U);
 }
 
+int mfd_npm2100_timer_idle(struct i2c_dev *dev, bool *idle)
+{
+	uint8_t timer_status;
+	int ret = i2c_reg_read_byte(dev, TIMER_STATUS, &timer_status);
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	*idle = (timer_status == TIMER_STATUS_IDLE);
+
+	return 0;
+}
+
 int mfd_npm2100_reset(struct i2c_dev *dev)
 {
 	return i2c_reg_write_byte(dev, RESET_TASKS_RESET, 1U);
@@ -139,8 +233,22 @@ int mfd_npm2100_reset(struct i2c_dev *dev)
 
 int mfd_npm2100_hibernate(struct i2c_dev *dev, uint32_t time_ms, bool pass_through)
 {
+	uint32_t ticks = 0U;
+
 	if (time_ms > 0) {
-		int ret = mfd_npm2100_set_timer(dev, time_ms, NPM2100_TIMER_MODE_WAKEUP);
+		ticks = MAX(mfd_npm2100_timer_ms_to_ticks(time_ms), 1U);
+		if (ticks > TIMER_MAX) {
+			return -EINVAL;
+		}
+	}
+
+	return mfd_npm2100_hibernate_ticks(dev, ticks, pass_through);
+}
+
+int mfd_npm2100_hibernate_ticks(struct i2c_dev *dev, uint32_t ticks, bool pass_through)
+{
+	if (ticks > 0) {
+		int ret = mfd_npm2100_set_timer_ticks(dev, ticks, NPM2100_TIMER_MODE_WAKEUP);
 
 		if (ret < 0) {
 			return ret;
@@ -156,54 +264,114 @@ int mfd_npm2100_hibernate(struct i2c_dev *dev, uint32_t time_ms, bool pass_throu
 	return i2c_reg_write_byte(dev, pass_through ? HIBERNATE_TASKS_HIBERPT : HIBERNATE_TASKS_HIBER, 1U);
 }
 
+/* Fold event bitfield into per-register masks, buf[0] is reserved for the register address */
+static inline void events_to_regs(uint32_t events, uint8_t buf[EVENTS_SIZE + 1U])
+{
+	buf[0] = 0U;
+	buf[1] = EVENT_REG_ENCODE(events, 0U);
+	buf[2] = EVENT_REG_ENCODE(events, 1U);
+	buf[3] = EVENT_REG_ENCODE(events, 2U);
+	buf[4] = EVENT_REG_ENCODE(events, 3U);
+	buf[5] = EVENT_REG_ENCODE(events, 4U);
+}
+
+/*
+ * Write the smallest contiguous span of non-zero register masks in one auto-increment
+ * transaction, nothing is written if all masks are zero.
+ * buf[0] is reserved for the register address, buf[1..EVENTS_SIZE] hold the masks.
+ */
+static int write_event_regs(struct i2c_dev *dev, uint8_t reg, uint8_t buf[EVENTS_SIZE + 1U])
+{
+	size_t first = 1U;
+	size_t last = EVENTS_SIZE;
+	int ret;
+
+	while ((first <= last) && (buf[first] == 0U)) {
+		first++;
+	}
+
+	if (first > last) {
+		return 0;
+	}
+
+	while (buf[last] == 0U) {
+		last--;
+	}
+
+	/* The byte preceding the first mask is either reserved or an unused zero mask */
+	buf[first - 1U] = reg + first - 1U;
+	ret = i2c_write(dev, &buf[first - 1U], last - first + 2U);
+	buf[first - 1U] = 0U;
+
+	return ret;
+}
+
 int mfd_npm2100_enable_events(struct i2c_dev *dev, uint32_t events)
 {
-	/* Enable interrupts for specified events */
-	for (int i = 0; i < NPM2100_EVENT_MAX; i++) {
-		if ((events & BIT(i)) != 0U) {
-			/* Clear pending interrupt */
-			int ret = i2c_reg_write_byte(dev, event_reg[i].offset + EVENTS_CLR,
-						     event_reg[i].mask);
-
-			if (ret < 0) {
-				return ret;
-			}
-
-			ret = i2c_reg_write_byte(dev, event_reg[i].offset + INTEN_SET,
-						 event_reg[i].mask);
-			if (ret < 0) {
-				return ret;
-			}
-		}
+	uint8_t buf[EVENTS_SIZE + 1U];
+	int ret;
+
+	if ((events & BIT_MASK(NPM2100_EVENT_MAX)) == 0U) {
+		return 0;
 	}
 
-	return 0;
+	events_to_regs(events, buf);
+
+	/* Clear pending interrupts */
+	ret = write_event_regs(dev, EVENTS_CLR, buf);
+	if (ret < 0) {
+		return ret;
+	}
+
+	/* Enable interrupts for specified events */
+	return write_event_regs(dev, INTEN_SET, buf);
 }
 
 int mfd_npm2100_disable_events(struct i2c_dev *dev, uint32_t events)
 {
+	uint8_t buf[EVENTS_SIZE + 1U];
+	int ret;
+
+	if ((events & BIT_MASK(NPM2100_EVENT_MAX)) == 0U) {
+		return 0;
+	}
+
+	events_to_regs(events, buf);
+
 	/* Disable interrupts for specified events */
-	for (int i = 0; i < NPM2100_EVENT_MAX; i++) {
-		if ((events & BIT(i)) != 0U) {
-			int ret = i2c_reg_write_byte(dev, event_reg[i].offset + INTEN_CLR,
-						     event_reg[i].mask);
-			if (ret < 0) {
-				return ret;
-			}
-
-			/* Clear pending interrupt */
-			ret = i2c_reg_write_byte(dev, event_reg[i].offset + EVENTS_CLR,
-						 event_reg[i].mask);
-
-			if (ret < 0) {
-				return ret;
-			}
-		}
+	ret = write_event_regs(dev, INTEN_CLR, buf);
+	if (ret < 0) {
+		return ret;
 	}
 
+	/* Clear pending interrupts */
+	return write_event_regs(dev, EVENTS_CLR, buf);
+}
+
+int mfd_npm2100_read_events(struct i2c_dev *dev, uint32_t *events)
+{
+	uint8_t buf[EVENTS_SIZE];
+	int ret;
+
+	ret = i2c_read(dev, EVENTS_SET, buf, sizeof(buf));
+	if (ret < 0) {
+		return ret;
+	}
+
+	*events = regs_to_events(buf);
+
 	return 0;
 }
 
+int mfd_npm2100_clear_events(struct i2c_dev *dev, uint32_t events)
+{
+	uint8_t buf[EVENTS_SIZE + 1U];
+
+	events_to_regs(events, buf);
+
+	return write_event_regs(dev, EVENTS_CLR, buf);
+}
+
 int mfd_npm2100_process_events(struct i2c_dev *dev, uint32_t *events)
 {
 	uint8_t buf[EVENTS_SIZE + 1U];
@@ -215,17 +383,29 @@ int mfd_npm2100_process_events(struct i2c_dev *dev, uint32_t *events)
 		return ret;
 	}
 
-	for (int i = 0; i < NPM2100_EVENT_MAX; i++) {
-		if ((buf[event_reg[i].offset + 1U] & event_reg[i].mask) != 0U) {
-			*events |= BIT(i);
-		}
-	}
+	*events = regs_to_events(&buf[1]);
 
-	/* Write read buffer back to clear registers to clear all processed events */
-	buf[0] = EVENTS_CLR;
-	ret = i2c_write(dev, buf, EVENTS_SIZE + 1U);
+	/* Write read buffer back to clear registers to clear all processed events,
+	 * skipped if nothing is set, otherwise limited to registers with set bits
+	 */
+	return write_event_regs(dev, EVENTS_CLR, buf);
+}
 
-	return ret;
+void mfd_npm2100_dispatch_events(struct i2c_dev *dev,
+				 const struct mfd_npm2100_event_callback *callbacks, uint32_t events)
+{
+	events &= BIT_MASK(NPM2100_EVENT_MAX);
+
+	while (events != 0U) {
+		enum mfd_npm2100_event_t event = u32_count_trailing_zeros(events);
+
+		/* Clear lowest set bit */
+		events &= events - 1U;
+
+		if (callbacks[event].handler != NULL) {
+			callbacks[event].handler(dev, event, callbacks[event].user_data);
+		}
+	}
 }
 
 int mfd_npm2100_config_shphld(struct i2c_dev *dev, const struct mfd_npm2100_shphld_config *config)
@@ -284,6 +464,55 @@ int mfd_npm2100_config_shphld(struct i2c_dev *dev, const struct mfd_npm2100_shph
 	return ret;
 }
 
+int mfd_npm2100_get_boot_info(struct i2c_dev *dev, struct mfd_npm2100_boot_info *info)
+{
+	uint8_t events[EVENTS_SIZE + 1U];
+	/* TIMER_CONFIG, TIMER_TARGET (3 bytes), TIMER_STATUS, TIMER_BOOT_MON */
+	uint8_t timer[TIMER_BOOT_MON - TIMER_CONFIG + 1U];
+	int ret;
+
+	ret = i2c_read(dev, EVENTS_SET, &events[1], EVENTS_SIZE);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = i2c_read(dev, TIMER_CONFIG, timer, sizeof(timer));
+	if (ret < 0) {
+		return ret;
+	}
+
+	info->events = regs_to_events(&events[1]);
+	info->timer_mode = timer[0];
+	info->timer_idle = (timer[TIMER_STATUS - TIMER_CONFIG] == TIMER_STATUS_IDLE);
+	info->boot_monitor = (timer[TIMER_BOOT_MON - TIMER_CONFIG] & BOOT_MON_ENABLE) != 0U;
+
+	info->causes = 0U;
+	if ((info->events & BIT(NPM2100_EVENT_SYS_TIMER_EXPIRY)) != 0U) {
+		switch (info->timer_mode) {
+		case NPM2100_TIMER_MODE_WAKEUP:
+			info->causes |= BIT(NPM2100_BOOT_CAUSE_TIMER_WAKEUP);
+			break;
+		case NPM2100_TIMER_MODE_WDT_RESET:
+		case NPM2100_TIMER_MODE_WDT_POWER_CYCLE:
+			info->causes |= BIT(NPM2100_BOOT_CAUSE_WATCHDOG);
+			break;
+		default:
+			break;
+		}
+	}
+	if ((info->events & (BIT(NPM2100_EVENT_SYS_SHIPHOLD_FALL) |
+			     BIT(NPM2100_EVENT_SYS_SHIPHOLD_RISE))) != 0U) {
+		info->causes |= BIT(NPM2100_BOOT_CAUSE_SHPHLD);
+	}
+	if ((info->events & (BIT(NPM2100_EVENT_SYS_PGRESET_FALL) |
+			     BIT(NPM2100_EVENT_SYS_PGRESET_RISE))) != 0U) {
+		info->causes |= BIT(NPM2100_BOOT_CAUSE_PGRESET);
+	}
+
+	/* Clear the latched events in one write, limited to registers with set bits */
+	return write_event_regs(dev, EVENTS_CLR, events);
+}
+
 int mfd_npm2100_config_reset(struct i2c_dev *dev, const struct mfd_npm2100_reset_config *config) {
 	int ret;
 
@@ -12,6 +12,25 @@
 
 #include "i2c.h"
 
+/* npm2100 timer frequency and maximum timer value */
+#define NPM2100_TIMER_TICK_HZ   64U
+#define NPM2100_TIMER_TICKS_MAX 0xFFFFFFU
+
+/**
+ * @brief Convert a time in ms to npm2100 timer ticks, rounded to the closest tick
+ *
+ * Intended for compile-time constants, use @ref mfd_npm2100_timer_ms_to_ticks for runtime
+ * values. The timer correction is not applied.
+ */
+#define NPM2100_TIMER_MS_TO_TICKS(ms)                                                              \
+	((uint32_t)(((uint64_t)(ms) * NPM2100_TIMER_TICK_HZ + 500U) / 1000U))
+
+/**
+ * @brief Convert npm2100 timer ticks to a time in ms, rounded to the closest ms
+ */
+#define NPM2100_TIMER_TICKS_TO_MS(ticks)                                                           \
+	((uint32_t)(((uint64_t)(ticks) * 1000U + NPM2100_TIMER_TICK_HZ / 2U) / NPM2100_TIMER_TICK_HZ))
+
 enum mfd_npm2100_event_t {
 	NPM2100_EVENT_SYS_DIETEMP_WARN,
 	NPM2100_EVENT_SYS_SHIPHOLD_FALL,
@@ -44,6 +63,32 @@ enum mfd_npm2100_timer_mode {
 	NPM2100_TIMER_MODE_WAKEUP,
 };
 
+/**
+ * @brief Boot causes, bit positions in mfd_npm2100_boot_info causes
+ */
+enum mfd_npm2100_boot_cause {
+	NPM2100_BOOT_CAUSE_TIMER_WAKEUP, /* hibernate ended by timer expiry */
+	NPM2100_BOOT_CAUSE_WATCHDOG,     /* watchdog expiry, reset or power cycle */
+	NPM2100_BOOT_CAUSE_SHPHLD,       /* SHPHLD pin activity, e.g. button press */
+	NPM2100_BOOT_CAUSE_PGRESET,      /* PG/RESET pin activity */
+};
+
+/**
+ * @brief Boot diagnostics snapshot
+ */
+struct mfd_npm2100_boot_info {
+	/* bitfield of boot causes (bits are defined by mfd_npm2100_boot_cause), 0 if unknown */
+	uint32_t causes;
+	/* events latched before boot (bits are defined by mfd_npm2100_event_t) */
+	uint32_t events;
+	/* timer mode configured before boot */
+	enum mfd_npm2100_timer_mode timer_mode;
+	/* timer is idle */
+	bool timer_idle;
+	/* watchdog boot monitor is running */
+	bool boot_monitor;
+};
+
 enum mfd_npm2100_shphld_pull {
 	NPM2100_SHPHLD_PULL_NONE,
 	NPM2100_SHPHLD_PULL_UP_RESISTOR,
@@ -74,6 +119,71 @@ struct mfd_npm2100_reset_config {
 	enum mfd_npm2100_reset_debounce debounce;
 };
 
+/**
+ * @brief Event handler
+ *
+ * @param dev device pointer, passed to i2c hal layer.
+ * @param event event being dispatched.
+ * @param user_data user context registered together with the handler.
+ */
+typedef void (*mfd_npm2100_event_handler_t)(struct i2c_dev *dev, enum mfd_npm2100_event_t event,
+					    void *user_data);
+
+/**
+ * @brief Event callback table entry
+ *
+ * A callback table is an array of NPM2100_EVENT_MAX entries indexed by mfd_npm2100_event_t.
+ * Entries without a handler are skipped. Tables can be declared const so they are placed in flash.
+ */
+struct mfd_npm2100_event_callback {
+	mfd_npm2100_event_handler_t handler;
+	void *user_data;
+};
+
+/**
+ * @brief Initializer for one entry of an event callback table
+ *
+ * Example:
+ * @code{.c}
+ * static const struct mfd_npm2100_event_callback callbacks[NPM2100_EVENT_MAX] = {
+ *	MFD_NPM2100_EVENT_CALLBACK(NPM2100_EVENT_SYS_TIMER_EXPIRY, on_timer, NULL),
+ *	MFD_NPM2100_EVENT_CALLBACK(NPM2100_EVENT_GPIO0_FALL, on_button, &button_ctx),
+ * };
+ * @endcode
+ *
+ * @param _event event identifier, one of mfd_npm2100_event_t.
+ * @param _handler handler to call when the event is dispatched.
+ * @param _user_data user context passed to the handler.
+ */
+#define MFD_NPM2100_EVENT_CALLBACK(_event, _handler, _user_data)                                   \
+	[_event] = {.handler = (_handler), .user_data = (_user_data)}
+
+/**
+ * @brief Set npm2100 timer oscillator correction
+ *
+ * The correction is applied whenever a time in ms is converted to timer ticks, including
+ * @ref mfd_npm2100_set_timer and @ref mfd_npm2100_hibernate. Tick-denominated calls are not
+ * affected.
+ *
+ * The conversion factor is computed here, so the conversion itself needs no division.
+ *
+ * @param ppm deviation of the timer oscillator from its nominal frequency in parts per million,
+ * positive if the oscillator runs fast. Clamped to +/-100000.
+ */
+void mfd_npm2100_set_timer_ppm(int32_t ppm);
+
+/**
+ * @brief Convert time to npm2100 timer ticks
+ *
+ * Rounds to the closest tick and applies the correction set by @ref mfd_npm2100_set_timer_ppm.
+ * Uses a single multiply and shift. Without correction the result is exact for any time
+ * within the timer range.
+ *
+ * @param time_ms time in ms
+ * @return Number of timer ticks, may exceed NPM2100_TIMER_TICKS_MAX
+ */
+uint32_t mfd_npm2100_timer_ms_to_ticks(uint32_t time_ms);
+
 /**
  * @brief Write npm2100 timer register
  *
@@ -84,6 +194,18 @@ struct mfd_npm2100_reset_config {
  */
 int mfd_npm2100_set_timer(struct i2c_dev *dev, uint32_t time_ms, enum mfd_npm2100_timer_mode mode);
 
+/**
+ * @brief Write npm2100 timer register in timer ticks
+ *
+ * @param dev device pointer, passed to i2c hal layer.
+ * @param ticks timer value in ticks of 1/NPM2100_TIMER_TICK_HZ s
+ * @param mode timer mode
+ * @return 0 If successful, -EINVAL if time value is too large, -EBUSY if the timer is not idle,
+ * -errno In case of any bus error
+ */
+int mfd_npm2100_set_timer_ticks(struct i2c_dev *dev, uint32_t ticks,
+				enum mfd_npm2100_timer_mode mode);
+
 /**
  * @brief Start npm2100 timer
  *
@@ -100,6 +222,18 @@ int mfd_npm2100_start_timer(struct i2c_dev *dev);
  */
 int mfd_npm2100_stop_timer(struct i2c_dev *dev);
 
+/**
+ * @brief Check whether npm2100 timer is idle
+ *
+ * The timer status turns idle some time after the timer is stopped or has expired.
+ * The timer can only be reconfigured with @ref mfd_npm2100_set_timer while idle.
+ *
+ * @param dev device pointer, passed to i2c hal layer.
+ * @param[out] idle Where timer idle state will be stored.
+ * @return 0 If successful, -errno In case of any bus error
+ */
+int mfd_npm2100_timer_idle(struct i2c_dev *dev, bool *idle);
+
 /**
  * @brief npm2100 full power reset
  *
@@ -120,9 +254,25 @@ int mfd_npm2100_reset(struct i2c_dev *dev);
  */
 int mfd_npm2100_hibernate(struct i2c_dev *dev, uint32_t time_ms, bool pass_through);
 
+/**
+ * @brief npm2100 hibernate, with wakeup time in timer ticks
+ *
+ * Enters low power state, and wakes after specified number of ticks. The timer correction is
+ * not applied.
+ *
+ * @param dev device pointer, passed to i2c hal layer.
+ * @param ticks timer value in ticks of 1/NPM2100_TIMER_TICK_HZ s, 0 to not start the timer.
+ * @param pass_through set to use pass-through hibernate mode.
+ * @return 0 If successful, -EINVAL if time value is too large, -errno In case of any bus error
+ */
+int mfd_npm2100_hibernate_ticks(struct i2c_dev *dev, uint32_t ticks, bool pass_through);
+
 /**
  * @brief  Enable npm2100 event interrupt
  *
+ * Pending events are cleared and interrupts enabled with one burst write each,
+ * regardless of how many events are selected.
+ *
  * @param dev device pointer, passed to i2c hal layer.
  * @param events bitfield of events to enable (bits are defined by mfd_npm2100_event_t)
  * @return 0 on success, -errno on failure
@@ -130,7 +280,10 @@ int mfd_npm2100_hibernate(struct i2c_dev *dev, uint32_t time_ms, bool pass_throu
 int mfd_npm2100_enable_events(struct i2c_dev *dev, uint32_t events);
 
 /**
- * @brief  Enable npm2100 event interrupt
+ * @brief  Disable npm2100 event interrupt
+ *
+ * Interrupts are disabled and pending events cleared with one burst write each,
+ * regardless of how many events are selected.
  *
  * @param dev device pointer, passed to i2c hal layer.
  * @param events bitfield of events to disable (bits are defined by mfd_npm2100_event_t)
@@ -138,11 +291,38 @@ int mfd_npm2100_enable_events(struct i2c_dev *dev, uint32_t events);
  */
 int mfd_npm2100_disable_events(struct i2c_dev *dev, uint32_t events);
 
+/**
+ * @brief  Read pending npm2100 events
+ *
+ * Reads the latched events in one burst read without clearing them, so they are still
+ * returned by the next mfd_npm2100_process_events.
+ *
+ * @param dev device pointer, passed to i2c hal layer.
+ * @param[out] events bitfield of pending events (bits are defined by mfd_npm2100_event_t)
+ * @return 0 on success, -errno on failure
+ */
+int mfd_npm2100_read_events(struct i2c_dev *dev, uint32_t *events);
+
+/**
+ * @brief  Clear pending npm2100 events
+ *
+ * Discards events latched before, e.g. ahead of a write whose completion is signalled by an
+ * event. Pending events are cleared with one burst write, interrupt enables are unchanged.
+ *
+ * @param dev device pointer, passed to i2c hal layer.
+ * @param events bitfield of events to clear (bits are defined by mfd_npm2100_event_t)
+ * @return 0 on success, -errno on failure
+ */
+int mfd_npm2100_clear_events(struct i2c_dev *dev, uint32_t events);
+
 /**
  * @brief  Process npm2100 event interrupt
  *
  * Reads and clears active interrupt events.
  *
+ * Only event registers with set bits are written back to be cleared, so a read that
+ * finds no active event costs a single bus transaction.
+ *
  * If an event occurs during processing, the interrupt will not be cleared.
  * The application should check the pin state and call the process function
  * again if the interrupt remains active.
@@ -153,6 +333,20 @@ int mfd_npm2100_disable_events(struct i2c_dev *dev, uint32_t events);
  */
 int mfd_npm2100_process_events(struct i2c_dev *dev, uint32_t *events);
 
+/**
+ * @brief  Dispatch npm2100 events to their handlers
+ *
+ * Calls the handler registered for every event set in the bitfield, in order of
+ * mfd_npm2100_event_t. Only set bits are visited, so the cost depends on the number of
+ * active events rather than on NPM2100_EVENT_MAX.
+ *
+ * @param dev device pointer, passed to i2c hal layer.
+ * @param callbacks callback table with NPM2100_EVENT_MAX entries, indexed by event.
+ * @param events bitfield of events to dispatch, as returned by mfd_npm2100_process_events
+ */
+void mfd_npm2100_dispatch_events(struct i2c_dev *dev,
+				 const struct mfd_npm2100_event_callback *callbacks, uint32_t events);
+
 /**
  * @brief Configure npm2100 SHPHLD pin
  *
@@ -162,6 +356,20 @@ int mfd_npm2100_process_events(struct i2c_dev *dev, uint32_t *events);
  */
 int mfd_npm2100_config_shphld(struct i2c_dev *dev, const struct mfd_npm2100_shphld_config *config);
 
+/**
+ * @brief Read npm2100 boot diagnostics
+ *
+ * Reads the event and timer registers in two burst reads, decodes why the system booted, and
+ * clears the latched events in one write. Boot causes are only derived from latched events, so
+ * a cause that latches no event is reported as unknown. Must be called before any other event
+ * function, which would clear the latched events.
+ *
+ * @param dev device pointer, passed to i2c hal layer.
+ * @param[out] info Where the boot diagnostics will be stored.
+ * @return 0 If successful, -errno In case of any bus error
+ */
+int mfd_npm2100_get_boot_info(struct i2c_dev *dev, struct mfd_npm2100_boot_info *info);
+
 /**
  * @brief Configure npm2100 reset behaviour
  *
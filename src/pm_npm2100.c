@@ -0,0 +1,195 @@
+/** @file
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "i2c.h"
+#include "mfd_npm2100.h"
+#include "pm_npm2100.h"
+#include "timer_npm2100.h"
+#include "util.h"
+
+/* Shortest PMIC timer wakeup, one timer tick */
+#define PM_TICK_MS 16U
+
+/* Weight of a new latency measurement in the average, as a power of two */
+#define PM_LATENCY_SHIFT 2U
+
+static inline bool state_usable(const struct pm_npm2100 *pm, int state)
+{
+	return (state == PM_NPM2100_STATE_IDLE) || ((pm->config->states & BIT(state)) != 0U);
+}
+
+static uint64_t energy_nj(const struct pm_npm2100 *pm, int state, uint64_t sleep_ms)
+{
+	const struct pm_npm2100_state_cost *cost = &pm->config->cost[state];
+
+	return cost->wakeup_uj * 1000ULL + cost->power_uw * sleep_ms;
+}
+
+/* Sleep time from which the state costs less energy than every lower state */
+static uint32_t threshold(const struct pm_npm2100 *pm, int state)
+{
+	const struct pm_npm2100_state_cost *cost = &pm->config->cost[state];
+	uint64_t min_ms;
+
+	if (state == PM_NPM2100_STATE_IDLE) {
+		return 0U;
+	}
+
+	/* The PMIC timer must expire the wakeup latency ahead of the event */
+	min_ms = DIV_ROUND_UP(pm->latency_us[state], 1000U) + PM_TICK_MS;
+
+	for (int i = PM_NPM2100_STATE_IDLE; i < state; i++) {
+		const struct pm_npm2100_state_cost *lower = &pm->config->cost[i];
+		uint64_t even_ms;
+
+		if (!state_usable(pm, i)) {
+			continue;
+		}
+
+		/* Never better than a state that costs at least as much to leave */
+		if (cost->power_uw >= lower->power_uw) {
+			if (cost->power_uw > lower->power_uw || cost->wakeup_uj >= lower->wakeup_uj) {
+				return UINT32_MAX;
+			}
+			continue;
+		}
+
+		/* Always better than a state that costs as much or more to leave */
+		if (cost->wakeup_uj <= lower->wakeup_uj) {
+			continue;
+		}
+
+		even_ms = DIV_ROUND_UP((cost->wakeup_uj - lower->wakeup_uj) * 1000ULL,
+				       lower->power_uw - cost->power_uw);
+		min_ms = MAX(min_ms, even_ms);
+	}
+
+	return (min_ms < UINT32_MAX) ? (uint32_t)min_ms : UINT32_MAX;
+}
+
+static void update_thresholds(struct pm_npm2100 *pm)
+{
+	for (int i = 0; i < PM_NPM2100_STATE_COUNT; i++) {
+		pm->threshold_ms[i] = state_usable(pm, i) ? threshold(pm, i) : UINT32_MAX;
+	}
+}
+
+void pm_npm2100_init(struct pm_npm2100 *pm, struct i2c_dev *dev,
+		     const struct pm_npm2100_config *config)
+{
+	pm->dev = dev;
+	pm->config = config;
+
+	for (int i = 0; i < PM_NPM2100_STATE_COUNT; i++) {
+		pm->latency_us[i] = config->cost[i].latency_us;
+		pm->entries[i] = 0U;
+	}
+
+	update_thresholds(pm);
+}
+
+enum pm_npm2100_state pm_npm2100_select(const struct pm_npm2100 *pm, uint32_t sleep_ms)
+{
+	int state = PM_NPM2100_STATE_COUNT - 1;
+
+	while ((state > PM_NPM2100_STATE_IDLE) && (sleep_ms < pm->threshold_ms[state])) {
+		state--;
+	}
+
+	return state;
+}
+
+int pm_npm2100_sleep(struct pm_npm2100 *pm, uint32_t sleep_ms, enum pm_npm2100_state *state)
+{
+	const struct pm_npm2100_config *config = pm->config;
+	enum pm_npm2100_state selected = pm_npm2100_select(pm, sleep_ms);
+	uint32_t wakeup_ms;
+	int ret;
+
+	if (state != NULL) {
+		*state = selected;
+	}
+
+	if (config->prepare != NULL) {
+		config->prepare(selected, config->user_data);
+	}
+
+	if (selected == PM_NPM2100_STATE_IDLE) {
+		pm->entries[selected]++;
+		config->enter(selected, sleep_ms, config->user_data);
+		return 0;
+	}
+
+	wakeup_ms = sleep_ms - DIV_ROUND_UP(pm->latency_us[selected], 1000U);
+
+	if (selected == PM_NPM2100_STATE_SYSTEM_OFF) {
+		ret = timer_npm2100_reconfigure(pm->dev, wakeup_ms,
+						NPM2100_TIMER_MODE_GENERAL_PURPOSE, NULL);
+		if (ret < 0) {
+			return ret;
+		}
+
+		/* The expiry interrupt is what wakes the host */
+		ret = mfd_npm2100_enable_events(pm->dev, BIT(NPM2100_EVENT_SYS_TIMER_EXPIRY));
+		if (ret < 0) {
+			return ret;
+		}
+
+		ret = mfd_npm2100_start_timer(pm->dev);
+	} else {
+		ret = mfd_npm2100_stop_timer(pm->dev);
+		if (ret < 0) {
+			return ret;
+		}
+
+		ret = timer_npm2100_wait_idle(pm->dev, TIMER_NPM2100_IDLE_TIMEOUT_US, NULL);
+		if (ret < 0) {
+			return ret;
+		}
+
+		ret = mfd_npm2100_hibernate(pm->dev, wakeup_ms,
+					    selected == PM_NPM2100_STATE_HIBERNATE_PT);
+	}
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	/* Counted once the PMIC is programmed, the host loses power in hibernate */
+	pm->entries[selected]++;
+
+	if (selected != PM_NPM2100_STATE_HIBERNATE) {
+		config->enter(selected, sleep_ms, config->user_data);
+	}
+
+	return 0;
+}
+
+void pm_npm2100_update_latency(struct pm_npm2100 *pm, enum pm_npm2100_state state,
+			       uint32_t latency_us)
+{
+	pm->latency_us[state] -= pm->latency_us[state] >> PM_LATENCY_SHIFT;
+	pm->latency_us[state] += latency_us >> PM_LATENCY_SHIFT;
+
+	update_thresholds(pm);
+}
+
+uint32_t pm_npm2100_energy_uj(const struct pm_npm2100 *pm, enum pm_npm2100_state state,
+			      uint32_t sleep_ms)
+{
+	uint64_t energy = DIV_ROUND_UP(energy_nj(pm, state, sleep_ms), 1000U);
+
+	return (energy < UINT32_MAX) ? (uint32_t)energy : UINT32_MAX;
+}
+
+uint32_t pm_npm2100_threshold_ms(const struct pm_npm2100 *pm, enum pm_npm2100_state state)
+{
+	return pm->threshold_ms[state];
+}
@@ -0,0 +1,144 @@
+/** @file
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef PM_NPM2100_H_
+#define PM_NPM2100_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "i2c.h"
+
+/**
+ * @brief Sleep states, in order of decreasing sleep power and increasing wakeup cost
+ */
+enum pm_npm2100_state {
+	/* host waits for event, wakeup by host timer */
+	PM_NPM2100_STATE_IDLE,
+	/* host System OFF, wakeup by PMIC timer interrupt */
+	PM_NPM2100_STATE_SYSTEM_OFF,
+	/* PMIC pass-through hibernate with host System OFF, wakeup by PMIC timer */
+	PM_NPM2100_STATE_HIBERNATE_PT,
+	/* PMIC hibernate, host is unpowered and boots on PMIC timer wakeup */
+	PM_NPM2100_STATE_HIBERNATE,
+	PM_NPM2100_STATE_COUNT,
+};
+
+/**
+ * @brief Cost model of a sleep state
+ */
+struct pm_npm2100_state_cost {
+	uint32_t power_uw;   /* average system power while sleeping */
+	uint32_t wakeup_uj;  /* energy spent entering and leaving the state */
+	uint32_t latency_us; /* time from wakeup until the host can resume work */
+};
+
+/**
+ * @brief Power manager configuration
+ *
+ * The configuration can be declared const so it is placed in flash.
+ */
+struct pm_npm2100_config {
+	/* bitfield of usable states, PM_NPM2100_STATE_IDLE is always usable */
+	uint32_t states;
+	/* initial cost model per state */
+	struct pm_npm2100_state_cost cost[PM_NPM2100_STATE_COUNT];
+	/* optional, called before the PMIC is programmed, e.g. to save state before hibernate */
+	void (*prepare)(enum pm_npm2100_state state, void *user_data);
+	/* enter the host side of the state: wait for event, or System OFF. Not called for
+	 * PM_NPM2100_STATE_HIBERNATE. For the idle state it receives the sleep time in ms.
+	 */
+	void (*enter)(enum pm_npm2100_state state, uint32_t sleep_ms, void *user_data);
+	/* user context passed to the hooks */
+	void *user_data;
+};
+
+/**
+ * @brief Power manager instance
+ *
+ * While sleeping in a state other than idle the power manager owns the PMIC timer.
+ * Fields are private.
+ */
+struct pm_npm2100 {
+	struct i2c_dev *dev;
+	const struct pm_npm2100_config *config;
+	uint32_t latency_us[PM_NPM2100_STATE_COUNT];
+	uint32_t threshold_ms[PM_NPM2100_STATE_COUNT];
+	uint32_t entries[PM_NPM2100_STATE_COUNT];
+};
+
+/**
+ * @brief Initialise power manager
+ *
+ * Computes the minimum sleep time for each state from the cost model.
+ *
+ * @param pm power manager.
+ * @param dev device pointer, passed to i2c hal layer.
+ * @param config state cost model and host hooks.
+ */
+void pm_npm2100_init(struct pm_npm2100 *pm, struct i2c_dev *dev,
+		     const struct pm_npm2100_config *config);
+
+/**
+ * @brief Select sleep state
+ *
+ * Returns the usable state with the lowest modelled energy for the sleep time. Thresholds are
+ * precomputed, so this costs one comparison per state.
+ *
+ * @param pm power manager.
+ * @param sleep_ms time until the next event in ms.
+ * @return Selected state
+ */
+enum pm_npm2100_state pm_npm2100_select(const struct pm_npm2100 *pm, uint32_t sleep_ms);
+
+/**
+ * @brief Sleep until the next event
+ *
+ * To be called from the host idle loop. Selects a state, programs the PMIC timer to expire the
+ * state latency ahead of the event, and enters the state. For System OFF the timer expiry event
+ * is enabled, so its interrupt wakes the host. Returns after waking from the idle state, or
+ * from System OFF states on hosts that resume execution.
+ *
+ * @param pm power manager.
+ * @param sleep_ms time until the next event in ms.
+ * @param[out] state optional, where the selected state will be stored.
+ * @return 0 on success, -errno on failure
+ */
+int pm_npm2100_sleep(struct pm_npm2100 *pm, uint32_t sleep_ms, enum pm_npm2100_state *state);
+
+/**
+ * @brief Report a measured wakeup latency
+ *
+ * Averages the measurement into the state latency and recomputes the thresholds. For the
+ * hibernate state this is typically measured at boot.
+ *
+ * @param pm power manager.
+ * @param state state woken up from.
+ * @param latency_us measured latency in us.
+ */
+void pm_npm2100_update_latency(struct pm_npm2100 *pm, enum pm_npm2100_state state,
+			       uint32_t latency_us);
+
+/**
+ * @brief Get modelled energy of a sleep
+ *
+ * @param pm power manager.
+ * @param state sleep state.
+ * @param sleep_ms sleep time in ms.
+ * @return Energy in uJ spent over the sleep, including entry and wakeup
+ */
+uint32_t pm_npm2100_energy_uj(const struct pm_npm2100 *pm, enum pm_npm2100_state state,
+			      uint32_t sleep_ms);
+
+/**
+ * @brief Get minimum sleep time of a state
+ *
+ * @param pm power manager.
+ * @param state sleep state.
+ * @return Sleep time in ms from which the state is selected, UINT32_MAX if never
+ */
+uint32_t pm_npm2100_threshold_ms(const struct pm_npm2100 *pm, enum pm_npm2100_state state);
+
+#endif /* PM_NPM2100_H_ */
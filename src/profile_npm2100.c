@@ -0,0 +1,177 @@
+/** @file
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "clock.h"
+#include "i2c.h"
+#include "profile_npm2100.h"
+#include "regulator_npm2100.h"
+#include "util.h"
+
+#define BOOST_VOUT    0x22U
+#define BOOST_VOUTSEL 0x23U
+#define BOOST_OPER    0x24U
+#define BOOST_GPIO    0x28U
+#define BOOST_PIN     0x29U
+#define LDOSW_VOUT    0x68U
+#define LDOSW_ENABLE  0x69U
+#define LDOSW_SEL     0x6AU
+#define LDOSW_GPIO    0x6BU
+#define GPIO_CONFIG   0x80U
+#define GPIO_USAGE    0x83U
+#define GPIO_OUTPUT   0x86U
+
+/* Register address of each profile register */
+static const uint8_t reg_addr[PROFILE_NPM2100_REG_COUNT] = {
+	[PROFILE_NPM2100_BOOST_VOUT] = BOOST_VOUT,
+	[PROFILE_NPM2100_BOOST_VOUTSEL] = BOOST_VOUTSEL,
+	[PROFILE_NPM2100_BOOST_OPER] = BOOST_OPER,
+	[PROFILE_NPM2100_BOOST_GPIO] = BOOST_GPIO,
+	[PROFILE_NPM2100_BOOST_PIN] = BOOST_PIN,
+	[PROFILE_NPM2100_LDOSW_VOUT] = LDOSW_VOUT,
+	[PROFILE_NPM2100_LDOSW_ENABLE] = LDOSW_ENABLE,
+	[PROFILE_NPM2100_LDOSW_SEL] = LDOSW_SEL,
+	[PROFILE_NPM2100_LDOSW_GPIO] = LDOSW_GPIO,
+	[PROFILE_NPM2100_GPIO_CONFIG0] = GPIO_CONFIG,
+	[PROFILE_NPM2100_GPIO_CONFIG1] = GPIO_CONFIG + 1U,
+	[PROFILE_NPM2100_GPIO_USAGE0] = GPIO_USAGE,
+	[PROFILE_NPM2100_GPIO_USAGE1] = GPIO_USAGE + 1U,
+	[PROFILE_NPM2100_GPIO_OUTPUT0] = GPIO_OUTPUT,
+	[PROFILE_NPM2100_GPIO_OUTPUT1] = GPIO_OUTPUT + 1U,
+};
+
+/* Profile registers of each regulator */
+#define PROFILE_BOOST_REGS (BIT_MASK(PROFILE_NPM2100_LDOSW_VOUT))
+#define PROFILE_LDOSW_REGS (BIT_MASK(PROFILE_NPM2100_GPIO_CONFIG0) & ~PROFILE_BOOST_REGS)
+
+BUILD_ASSERT(PROFILE_NPM2100_REG_COUNT <= 16, "known bitmask too small");
+
+/* Register of profile index i directly follows the one of index i - 1 */
+static inline bool adjacent(int i)
+{
+	return (i > 0) && (reg_addr[i] == reg_addr[i - 1] + 1U);
+}
+
+/* Forget the registers of a regulator changed through the regulator driver */
+static void changed(struct i2c_dev *dev, enum npm2100_regulator_source source,
+		    enum regulator_npm2100_change change, int32_t value, void *user_data)
+{
+	struct profile_npm2100_engine *engine = user_data;
+
+	(void)dev;
+	(void)change;
+	(void)value;
+
+	if (engine->applying) {
+		return;
+	}
+
+	engine->known &= (source == NPM2100_SOURCE_BOOST) ? ~PROFILE_BOOST_REGS
+							  : ~PROFILE_LDOSW_REGS;
+}
+
+void profile_npm2100_init(struct profile_npm2100_engine *engine, struct i2c_dev *dev)
+{
+	engine->dev = dev;
+	engine->known = 0U;
+	engine->applying = false;
+
+	engine->listener.changed = changed;
+	engine->listener.user_data = engine;
+	regulator_npm2100_add_listener(&engine->listener);
+}
+
+int profile_npm2100_apply(struct profile_npm2100_engine *engine,
+			  const struct profile_npm2100 *profile,
+			  struct profile_npm2100_report *report)
+{
+	uint8_t buf[PROFILE_NPM2100_REG_COUNT + 1U];
+	uint32_t start_us = clock_get_us();
+	uint16_t dirty = 0U;
+	uint8_t registers = 0U;
+	uint8_t transactions = 0U;
+	int ret = 0;
+
+	for (int i = 0; i < PROFILE_NPM2100_REG_COUNT; i++) {
+		if (profile->reg[i].set && (((engine->known & BIT(i)) == 0U) ||
+					    (engine->val[i] != profile->reg[i].val))) {
+			dirty |= BIT(i);
+			registers++;
+		}
+	}
+
+	/* Changes reported by the writes below are already in the image */
+	engine->applying = true;
+
+	for (int i = 0; (i < PROFILE_NPM2100_REG_COUNT) && (ret == 0); i++) {
+		int last = i;
+		size_t len = 1U;
+
+		if ((dirty & BIT(i)) == 0U) {
+			continue;
+		}
+
+		/* Extend the burst over adjacent registers that are dirty, or defined by the
+		 * profile and followed by a dirty register in the same run. A register the
+		 * profile does not define is never rewritten, its known value may be stale.
+		 */
+		for (int j = i + 1; (j < PROFILE_NPM2100_REG_COUNT) && adjacent(j); j++) {
+			if (!profile->reg[j].set) {
+				break;
+			}
+
+			if ((dirty & BIT(j)) != 0U) {
+				last = j;
+			}
+		}
+
+		buf[0] = reg_addr[i];
+		for (int j = i; j <= last; j++) {
+			buf[len++] = profile->reg[j].val;
+		}
+
+		ret = i2c_write(engine->dev, buf, len);
+		transactions++;
+
+		for (int j = i; j <= last; j++) {
+			if (ret < 0) {
+				/* Register state after a failed write is unknown */
+				engine->known &= ~BIT(j);
+			} else if ((dirty & BIT(j)) != 0U) {
+				engine->val[j] = profile->reg[j].val;
+				engine->known |= BIT(j);
+			}
+		}
+
+		if (ret < 0) {
+			regulator_npm2100_invalidate_cache(engine->dev);
+		} else if (reg_addr[i] < GPIO_CONFIG) {
+			/* Keep the regulator cache and listeners in step */
+			ret = regulator_npm2100_registers_written(engine->dev, buf[0], &buf[1],
+								  len - 1U);
+		}
+
+		i = last;
+	}
+
+	engine->applying = false;
+
+	if (report != NULL) {
+		report->elapsed_us = clock_get_us() - start_us;
+		report->registers = registers;
+		report->transactions = transactions;
+	}
+
+	return ret;
+}
+
+void profile_npm2100_invalidate(struct profile_npm2100_engine *engine)
+{
+	engine->known = 0U;
+}
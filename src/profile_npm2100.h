@@ -0,0 +1,236 @@
+/** @file
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef PROFILE_NPM2100_H_
+#define PROFILE_NPM2100_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "gpio_npm2100.h"
+#include "i2c.h"
+#include "regulator_npm2100.h"
+
+/**
+ * @brief Registers covered by power profiles, in register address order
+ */
+enum profile_npm2100_reg {
+	PROFILE_NPM2100_BOOST_VOUT,
+	PROFILE_NPM2100_BOOST_VOUTSEL,
+	PROFILE_NPM2100_BOOST_OPER,
+	PROFILE_NPM2100_BOOST_GPIO,
+	PROFILE_NPM2100_BOOST_PIN,
+	PROFILE_NPM2100_LDOSW_VOUT,
+	PROFILE_NPM2100_LDOSW_ENABLE,
+	PROFILE_NPM2100_LDOSW_SEL,
+	PROFILE_NPM2100_LDOSW_GPIO,
+	PROFILE_NPM2100_GPIO_CONFIG0,
+	PROFILE_NPM2100_GPIO_CONFIG1,
+	PROFILE_NPM2100_GPIO_USAGE0,
+	PROFILE_NPM2100_GPIO_USAGE1,
+	PROFILE_NPM2100_GPIO_OUTPUT0,
+	PROFILE_NPM2100_GPIO_OUTPUT1,
+	PROFILE_NPM2100_REG_COUNT,
+};
+
+/**
+ * @brief Power profile register value
+ */
+struct profile_npm2100_value {
+	uint8_t val;
+	bool set;
+};
+
+/**
+ * @brief Power profile
+ *
+ * Register image with the registers the profile defines, built with PROFILE_NPM2100_INIT.
+ * Registers not defined by the profile are left unchanged when it is applied.
+ *
+ * Example:
+ * @code{.c}
+ * static const struct profile_npm2100 radio_profile = PROFILE_NPM2100_INIT(
+ *	PROFILE_NPM2100_BOOST_VOLTAGE(3000000),
+ *	PROFILE_NPM2100_BOOST_MODE(NPM2100_REG_OPER_HP),
+ *	PROFILE_NPM2100_LDOSW_MODE(NPM2100_REG_OPER_HP | NPM2100_REG_LDSW_EN),
+ *	PROFILE_NPM2100_GPIO(0, NPM2100_GPIO_MODE_GPIO, NPM2100_GPIO_CONFIG_OUTPUT));
+ * @endcode
+ */
+struct profile_npm2100 {
+	struct profile_npm2100_value reg[PROFILE_NPM2100_REG_COUNT];
+};
+
+/** @brief Build a power profile from PROFILE_NPM2100_ register settings */
+#define PROFILE_NPM2100_INIT(...) {.reg = {__VA_ARGS__}}
+
+/** @brief Set a profile register to a raw value */
+#define PROFILE_NPM2100_REG(_reg, _val) [_reg] = {.val = (_val), .set = true}
+
+/**
+ * @brief Boost output voltage in uV under software control
+ *
+ * Rounded up to the next supported voltage, a voltage outside the boost range fails to compile.
+ */
+#define PROFILE_NPM2100_BOOST_VOLTAGE(_uv)                                                         \
+	PROFILE_NPM2100_REG(PROFILE_NPM2100_BOOST_VOUT, NPM2100_BOOST_UV_TO_IDX(_uv)),             \
+		PROFILE_NPM2100_REG(PROFILE_NPM2100_BOOST_VOUTSEL, NPM2100_BOOST_VOUTSEL_REGISTER)
+
+/**
+ * @brief Boost operating mode
+ *
+ * A mode the boost does not support fails to compile.
+ *
+ * @param _oper one of NPM2100_REG_OPER_AUTO, _HP, _LP, _PASS or _NOHP.
+ */
+#define PROFILE_NPM2100_BOOST_MODE(_oper)                                                          \
+	PROFILE_NPM2100_REG(                                                                       \
+		PROFILE_NPM2100_BOOST_OPER,                                                        \
+		(((_oper) == NPM2100_REG_OPER_NOHP)   ? NPM2100_BOOST_OPER_MODE_NOHP               \
+		 : ((_oper) == NPM2100_REG_OPER_PASS) ? NPM2100_BOOST_OPER_MODE_PASS               \
+		 : ((_oper) == NPM2100_REG_OPER_LP)   ? NPM2100_BOOST_OPER_MODE_LP                 \
+		 : ((_oper) == NPM2100_REG_OPER_HP)   ? NPM2100_BOOST_OPER_MODE_HP                 \
+						      : NPM2100_BOOST_OPER_MODE_AUTO) +            \
+			ZERO_OR_COMPILE_ERROR(((_oper) == NPM2100_REG_OPER_AUTO) ||                \
+					      ((_oper) == NPM2100_REG_OPER_HP) ||                  \
+					      ((_oper) == NPM2100_REG_OPER_LP) ||                  \
+					      ((_oper) == NPM2100_REG_OPER_PASS) ||                \
+					      ((_oper) == NPM2100_REG_OPER_NOHP)))
+
+/**
+ * @brief Boost mode forced while a pin is active
+ *
+ * A mode the boost cannot force fails to compile.
+ *
+ * @param _force one of NPM2100_REG_FORCE_HP, _LP, _PASS or _NOHP.
+ * @param _pin GPIO pin number.
+ * @param _active_low pin polarity.
+ */
+#define PROFILE_NPM2100_BOOST_FORCE(_force, _pin, _active_low)                                     \
+	PROFILE_NPM2100_REG(PROFILE_NPM2100_BOOST_GPIO,                                            \
+			    ((_pin) << 1U) + ((_active_low) ? 0U : 1U) + 1U),                      \
+		PROFILE_NPM2100_REG(                                                               \
+			PROFILE_NPM2100_BOOST_PIN,                                                 \
+			(((_force) == NPM2100_REG_FORCE_NOHP)   ? NPM2100_BOOST_PIN_FORCE_NOHP     \
+			 : ((_force) == NPM2100_REG_FORCE_PASS) ? NPM2100_BOOST_PIN_FORCE_PASS     \
+			 : ((_force) == NPM2100_REG_FORCE_LP)   ? NPM2100_BOOST_PIN_FORCE_LP       \
+								: NPM2100_BOOST_PIN_FORCE_HP) +    \
+				ZERO_OR_COMPILE_ERROR(((_force) == NPM2100_REG_FORCE_HP) ||        \
+						      ((_force) == NPM2100_REG_FORCE_LP) ||        \
+						      ((_force) == NPM2100_REG_FORCE_PASS) ||      \
+						      ((_force) == NPM2100_REG_FORCE_NOHP)))
+
+/**
+ * @brief LDOSW output voltage in uV
+ *
+ * Rounded up to the next supported voltage, a voltage outside the LDOSW range fails to compile.
+ */
+#define PROFILE_NPM2100_LDOSW_VOLTAGE(_uv)                                                         \
+	PROFILE_NPM2100_REG(PROFILE_NPM2100_LDOSW_VOUT, NPM2100_LDOSW_UV_TO_IDX(_uv))
+
+/** @brief LDOSW enable */
+#define PROFILE_NPM2100_LDOSW_ENABLE(_enable)                                                      \
+	PROFILE_NPM2100_REG(PROFILE_NPM2100_LDOSW_ENABLE, (_enable) ? 1U : 0U)
+
+/** @brief LDOSW_SEL value of a LDOSW software controlled mode, others fail to compile */
+#define PROFILE_NPM2100_LDOSW_SEL_OPER(_oper)                                                      \
+	((((_oper) == NPM2100_REG_OPER_HP)    ? NPM2100_LDOSW_SEL_OPER_HP                          \
+	  : ((_oper) == NPM2100_REG_OPER_ULP) ? NPM2100_LDOSW_SEL_OPER_ULP                         \
+					      : NPM2100_LDOSW_SEL_OPER_AUTO) +                     \
+	 ZERO_OR_COMPILE_ERROR(((_oper) == NPM2100_REG_OPER_AUTO) ||                               \
+			       ((_oper) == NPM2100_REG_OPER_ULP) ||                                \
+			       ((_oper) == NPM2100_REG_OPER_HP)))
+
+/**
+ * @brief LDOSW software controlled mode
+ *
+ * A mode LDOSW does not support under software control fails to compile.
+ *
+ * @param _mode one of NPM2100_REG_OPER_AUTO, _ULP or _HP, optionally combined with
+ * NPM2100_REG_LDSW_EN.
+ */
+#define PROFILE_NPM2100_LDOSW_MODE(_mode)                                                          \
+	PROFILE_NPM2100_REG(PROFILE_NPM2100_LDOSW_SEL,                                             \
+			    PROFILE_NPM2100_LDOSW_SEL_OPER((_mode) & ~NPM2100_REG_LDSW_EN) |       \
+				    ((_mode) & NPM2100_REG_LDSW_EN))
+
+/**
+ * @brief GPIO configuration, see gpio_npm2100_config
+ *
+ * @param _pin GPIO pin number, 0 or 1.
+ * @param _mode one of NPM2100_GPIO_MODE_.
+ * @param _flags combination of NPM2100_GPIO_CONFIG_.
+ */
+#define PROFILE_NPM2100_GPIO(_pin, _mode, _flags)                                                  \
+	PROFILE_NPM2100_REG(PROFILE_NPM2100_GPIO_USAGE0 + (_pin), _mode),                          \
+		PROFILE_NPM2100_REG(PROFILE_NPM2100_GPIO_CONFIG0 + (_pin), _flags)
+
+/** @brief GPIO output state, see gpio_npm2100_set */
+#define PROFILE_NPM2100_GPIO_OUTPUT(_pin, _state)                                                  \
+	PROFILE_NPM2100_REG(PROFILE_NPM2100_GPIO_OUTPUT0 + (_pin), (_state) ? 1U : 0U)
+
+/**
+ * @brief Power profile engine
+ *
+ * Tracks the register values written by profiles. Regulator settings changed through the
+ * regulator driver make the engine forget the values of that regulator. Fields are private.
+ */
+struct profile_npm2100_engine {
+	struct i2c_dev *dev;
+	struct regulator_npm2100_listener listener;
+	bool applying;
+	uint16_t known;
+	uint8_t val[PROFILE_NPM2100_REG_COUNT];
+};
+
+/**
+ * @brief Power profile application report
+ */
+struct profile_npm2100_report {
+	uint32_t elapsed_us;  /* time spent applying the profile */
+	uint8_t registers;    /* registers that differed from the current values */
+	uint8_t transactions; /* bus transactions issued */
+};
+
+/**
+ * @brief Initialise power profile engine
+ *
+ * No register values are known, the first profile applied writes all its registers. Registers
+ * as regulator listener.
+ *
+ * @param engine power profile engine.
+ * @param dev device pointer, passed to i2c hal layer.
+ */
+void profile_npm2100_init(struct profile_npm2100_engine *engine, struct i2c_dev *dev);
+
+/**
+ * @brief Apply a power profile
+ *
+ * Writes only the registers that differ from the current values, in register address order.
+ * Consecutive registers are written in one auto-increment burst, which may include unchanged
+ * registers defined by the profile to join two bursts. Written regulator registers are
+ * reported with regulator_npm2100_registers_written, which updates the regulator state cache
+ * and notifies regulator listeners.
+ *
+ * @param engine power profile engine.
+ * @param profile power profile to apply.
+ * @param[out] report optional, time taken and bus usage.
+ * @return 0 If successful, -errno In case of any bus error
+ */
+int profile_npm2100_apply(struct profile_npm2100_engine *engine,
+			  const struct profile_npm2100 *profile,
+			  struct profile_npm2100_report *report);
+
+/**
+ * @brief Forget the current register values
+ *
+ * Needed after the nPM2100 was reset, or registers were written other than through the
+ * regulator mode, voltage and enable settings, e.g. with regulator_npm2100_pin_ctrl or the
+ * GPIO driver.
+ *
+ * @param engine power profile engine.
+ */
+void profile_npm2100_invalidate(struct profile_npm2100_engine *engine);
+
+#endif /* PROFILE_NPM2100_H_ */
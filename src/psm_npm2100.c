@@ -0,0 +1,200 @@
+/** @file
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "clock.h"
+#include "i2c.h"
+#include "mfd_npm2100.h"
+#include "profile_npm2100.h"
+#include "psm_npm2100.h"
+#include "regulator_npm2100.h"
+#include "timer_npm2100.h"
+#include "util.h"
+
+/* Check that a state can be left again once entered */
+static bool state_leavable(const struct psm_npm2100_config *config, int state)
+{
+	bool shphld_wakeup = (config->shphld != NULL) && !config->shphld->disable_wakeup_from_hiber;
+
+	switch (state) {
+	case PSM_NPM2100_STATE_HIBERNATE:
+	case PSM_NPM2100_STATE_HIBERNATE_PT:
+		return (config->hibernate_ms > 0U) || shphld_wakeup;
+	case PSM_NPM2100_STATE_SHIP:
+		return config->shphld != NULL;
+	default:
+		return true;
+	}
+}
+
+/* Accumulate the time spent in the current state */
+static void account(struct psm_npm2100 *psm)
+{
+	uint32_t now = clock_get_ms();
+
+	psm->time_ms[psm->state] += now - psm->entered_ms;
+	psm->entered_ms = now;
+}
+
+int psm_npm2100_init(struct psm_npm2100 *psm, struct i2c_dev *dev,
+		     const struct psm_npm2100_config *config)
+{
+	const struct profile_npm2100 *profile;
+	int ret;
+
+	psm->dev = dev;
+	psm->config = config;
+	psm->state = PSM_NPM2100_STATE_ACTIVE;
+	psm->entered_ms = clock_get_ms();
+
+	if (mfd_npm2100_timer_ms_to_ticks(config->hibernate_ms) > NPM2100_TIMER_TICKS_MAX) {
+		return -EINVAL;
+	}
+
+	for (int i = 0; i < PSM_NPM2100_STATE_COUNT; i++) {
+		psm->time_ms[i] = 0U;
+		psm->edges[i] = config->state[i].edges & BIT_MASK(PSM_NPM2100_STATE_COUNT);
+
+		for (int j = 0; j < PSM_NPM2100_STATE_COUNT; j++) {
+			if (((psm->edges[i] & BIT(j)) != 0U) && !state_leavable(config, j)) {
+				return -EINVAL;
+			}
+		}
+	}
+
+	profile_npm2100_init(&psm->engine, dev);
+
+	if (config->shphld != NULL) {
+		ret = mfd_npm2100_config_shphld(dev, config->shphld);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	profile = config->state[PSM_NPM2100_STATE_ACTIVE].profile;
+	if (profile == NULL) {
+		return 0;
+	}
+
+	return profile_npm2100_apply(&psm->engine, profile, NULL);
+}
+
+int psm_npm2100_enter(struct psm_npm2100 *psm, enum psm_npm2100_state state)
+{
+	const struct psm_npm2100_config *config = psm->config;
+	const struct profile_npm2100 *profile;
+	int ret;
+
+	if (state >= PSM_NPM2100_STATE_COUNT) {
+		return -EINVAL;
+	}
+
+	if ((psm->edges[psm->state] & BIT(state)) == 0U) {
+		return -ENOTSUP;
+	}
+
+	if ((state == PSM_NPM2100_STATE_HIBERNATE) || (state == PSM_NPM2100_STATE_HIBERNATE_PT)) {
+		/* The wakeup timer can only be written while idle */
+		ret = mfd_npm2100_stop_timer(psm->dev);
+		if (ret < 0) {
+			return ret;
+		}
+
+		ret = timer_npm2100_wait_idle(psm->dev, TIMER_NPM2100_IDLE_TIMEOUT_US, NULL);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	/* The edge program is the register difference against the live engine image, rather
+	 * than one precomputed from the two profiles: other modules change regulator registers
+	 * between transitions, which a per-edge program could not see
+	 */
+	profile = config->state[state].profile;
+	if (profile != NULL) {
+		ret = profile_npm2100_apply(&psm->engine, profile, NULL);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	/* Account before the task, the host may lose power once it is written */
+	account(psm);
+
+	switch (state) {
+	case PSM_NPM2100_STATE_HIBERNATE:
+	case PSM_NPM2100_STATE_HIBERNATE_PT:
+		ret = mfd_npm2100_hibernate(psm->dev, config->hibernate_ms,
+					    state == PSM_NPM2100_STATE_HIBERNATE_PT);
+		break;
+	case PSM_NPM2100_STATE_SHIP:
+		ret = regulator_npm2100_ship_mode(psm->dev);
+		break;
+	default:
+		ret = 0;
+		break;
+	}
+
+	if (ret == 0) {
+		psm->state = state;
+	}
+
+	return ret;
+}
+
+int psm_npm2100_wakeup(struct psm_npm2100 *psm)
+{
+	const struct profile_npm2100 *profile;
+
+	if (psm->state != PSM_NPM2100_STATE_HIBERNATE_PT) {
+		return -EALREADY;
+	}
+
+	account(psm);
+	psm->state = PSM_NPM2100_STATE_ACTIVE;
+
+	/* Registers may have been reset to their defaults by the hibernate cycle */
+	profile_npm2100_invalidate(&psm->engine);
+
+	profile = psm->config->state[PSM_NPM2100_STATE_ACTIVE].profile;
+	if (profile == NULL) {
+		return 0;
+	}
+
+	return profile_npm2100_apply(&psm->engine, profile, NULL);
+}
+
+enum psm_npm2100_state psm_npm2100_get_state(const struct psm_npm2100 *psm)
+{
+	return psm->state;
+}
+
+uint64_t psm_npm2100_get_time_ms(const struct psm_npm2100 *psm, enum psm_npm2100_state state)
+{
+	uint64_t time = psm->time_ms[state];
+
+	if (state == psm->state) {
+		time += clock_get_ms() - psm->entered_ms;
+	}
+
+	return time;
+}
+
+uint64_t psm_npm2100_get_energy_uj(const struct psm_npm2100 *psm)
+{
+	uint64_t energy_nj = 0U;
+
+	/* uW * ms is nJ */
+	for (int i = 0; i < PSM_NPM2100_STATE_COUNT; i++) {
+		energy_nj += (uint64_t)psm->config->state[i].power_uw *
+			     psm_npm2100_get_time_ms(psm, i);
+	}
+
+	return energy_nj / 1000U;
+}
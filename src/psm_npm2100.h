@@ -0,0 +1,136 @@
+/** @file
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef PSM_NPM2100_H_
+#define PSM_NPM2100_H_
+
+#include <stdint.h>
+
+#include "i2c.h"
+#include "mfd_npm2100.h"
+#include "profile_npm2100.h"
+
+/**
+ * @brief Device power states
+ */
+enum psm_npm2100_state {
+	PSM_NPM2100_STATE_ACTIVE,
+	PSM_NPM2100_STATE_IDLE,
+	/* PMIC hibernate, the host is unpowered until timer or SHPHLD wakeup */
+	PSM_NPM2100_STATE_HIBERNATE,
+	/* PMIC hibernate with output in pass-through, the host stays powered */
+	PSM_NPM2100_STATE_HIBERNATE_PT,
+	/* PMIC ship mode, the host is unpowered until SHPHLD wakeup */
+	PSM_NPM2100_STATE_SHIP,
+	PSM_NPM2100_STATE_COUNT,
+};
+
+/**
+ * @brief Power state declaration
+ */
+struct psm_npm2100_state_config {
+	/* optional register settings applied when entering the state */
+	const struct profile_npm2100 *profile;
+	/* bitfield of states that can be entered from this state */
+	uint32_t edges;
+	/* average system power in the state, for the power budget */
+	uint32_t power_uw;
+};
+
+/**
+ * @brief Power state machine configuration
+ *
+ * The configuration can be declared const so it is placed in flash.
+ */
+struct psm_npm2100_config {
+	struct psm_npm2100_state_config state[PSM_NPM2100_STATE_COUNT];
+	/* optional SHPHLD configuration, applied at init. Required to leave ship mode */
+	const struct mfd_npm2100_shphld_config *shphld;
+	/* hibernate wakeup timer in ms, 0 for SHPHLD wakeup only */
+	uint32_t hibernate_ms;
+};
+
+/**
+ * @brief Power state machine
+ *
+ * Fields are private.
+ */
+struct psm_npm2100 {
+	struct i2c_dev *dev;
+	const struct psm_npm2100_config *config;
+	struct profile_npm2100_engine engine;
+	enum psm_npm2100_state state;
+	uint32_t edges[PSM_NPM2100_STATE_COUNT];
+	uint32_t entered_ms;
+	uint64_t time_ms[PSM_NPM2100_STATE_COUNT];
+};
+
+/**
+ * @brief Initialise power state machine
+ *
+ * Validates every declared edge, applies the SHPHLD configuration and enters the active state.
+ *
+ * @param psm power state machine.
+ * @param dev device pointer, passed to i2c hal layer.
+ * @param config state declarations.
+ * @return 0 on success, -EINVAL if a declared edge leads to a state that could not be left or
+ * the hibernate time is out of range, -errno on bus failure
+ */
+int psm_npm2100_init(struct psm_npm2100 *psm, struct i2c_dev *dev,
+		     const struct psm_npm2100_config *config);
+
+/**
+ * @brief Enter a power state
+ *
+ * Applies the state profile as one batched register sequence, writing only the registers that
+ * differ from the current values, followed by the hibernate or ship task for those states.
+ * The state only changes once the task was written. Does not return on success for states that
+ * unpower the host.
+ *
+ * @param psm power state machine.
+ * @param state state to enter.
+ * @return 0 on success, -EINVAL for an unknown state, -ENOTSUP if there is no edge from the
+ * current state, -errno on failure
+ */
+int psm_npm2100_enter(struct psm_npm2100 *psm, enum psm_npm2100_state state);
+
+/**
+ * @brief Resume after pass-through hibernate
+ *
+ * To be called once the host runs again after a wakeup from pass-through hibernate. Accounts
+ * the time spent and re-enters the active state.
+ *
+ * @param psm power state machine.
+ * @return 0 on success, -EALREADY if not in pass-through hibernate, -errno on failure
+ */
+int psm_npm2100_wakeup(struct psm_npm2100 *psm);
+
+/**
+ * @brief Get current power state
+ *
+ * @param psm power state machine.
+ * @return Current state
+ */
+enum psm_npm2100_state psm_npm2100_get_state(const struct psm_npm2100 *psm);
+
+/**
+ * @brief Get time spent in a power state
+ *
+ * @param psm power state machine.
+ * @param state power state.
+ * @return Time in ms, including the ongoing stay in the current state. The total does not
+ *         wrap, a single stay is measured with clock_get_ms and must be shorter than 2^32 ms.
+ */
+uint64_t psm_npm2100_get_time_ms(const struct psm_npm2100 *psm, enum psm_npm2100_state state);
+
+/**
+ * @brief Get energy used since init, from the time in each state and its declared power
+ *
+ * @param psm power state machine.
+ * @return Energy in uJ
+ */
+uint64_t psm_npm2100_get_energy_uj(const struct psm_npm2100 *psm);
+
+#endif /* PSM_NPM2100_H_ */
@@ -0,0 +1,319 @@
+/** @file
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "clock.h"
+#include "i2c.h"
+#include "mfd_npm2100.h"
+#include "ramp_npm2100.h"
+#include "regulator_npm2100.h"
+#include "util.h"
+#include "vtimer_npm2100.h"
+
+/* Events after which the ramp is stopped */
+#define RAMP_STOP_EVENTS                                                                           \
+	(BIT(NPM2100_EVENT_BOOST_VOUT_WARN) | BIT(NPM2100_EVENT_BOOST_VBAT_WARN))
+
+/* Shortest interval when paced by the PMIC timer, one timer tick */
+#define RAMP_VT_INTERVAL_MIN_MS DIV_ROUND_UP(1000U, NPM2100_TIMER_TICK_HZ)
+
+#define BOOST_IDX_MAX NPM2100_BOOST_UV_TO_IDX(NPM2100_BOOST_MAX_UV)
+#define LDOSW_IDX_MAX NPM2100_LDOSW_UV_TO_IDX(NPM2100_LDOSW_MAX_UV)
+
+static bool idx_valid(const struct ramp_npm2100 *ramp, uint8_t idx)
+{
+	if (ramp->config->source == NPM2100_SOURCE_BOOST) {
+		return idx <= BOOST_IDX_MAX;
+	}
+
+	return (idx >= NPM2100_LDOSW_MIN_IDX) && (idx <= LDOSW_IDX_MAX);
+}
+
+/* Register index of the present output voltage, VSET selected voltages included */
+static int present_idx(struct ramp_npm2100 *ramp, uint8_t *idx)
+{
+	int32_t volt_uv;
+	int ret;
+
+	ret = regulator_npm2100_get_voltage(ramp->dev, ramp->config->source, &volt_uv);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (ramp->config->source == NPM2100_SOURCE_BOOST) {
+		volt_uv = CLAMP(volt_uv, NPM2100_BOOST_MIN_UV, NPM2100_BOOST_MAX_UV);
+		*idx = DIV_ROUND_UP(volt_uv - NPM2100_BOOST_MIN_UV, NPM2100_BOOST_STEP_UV);
+	} else {
+		volt_uv = CLAMP(volt_uv, NPM2100_LDOSW_MIN_UV, NPM2100_LDOSW_MAX_UV);
+		*idx = NPM2100_LDOSW_MIN_IDX +
+		       DIV_ROUND_UP(volt_uv - NPM2100_LDOSW_MIN_UV, NPM2100_LDOSW_STEP_UV);
+	}
+
+	return 0;
+}
+
+/* Write the next index, moving up to one step towards the target */
+static int advance(struct ramp_npm2100 *ramp)
+{
+	uint8_t idx;
+
+	if (ramp->target > ramp->idx) {
+		idx = MIN(ramp->idx + ramp->step, ramp->target);
+	} else {
+		idx = MAX(ramp->idx - ramp->step, ramp->target);
+	}
+
+	ramp->idx = idx;
+
+	return regulator_npm2100_set_voltage_idx(ramp->dev, ramp->config->source, idx);
+}
+
+static void finish(struct ramp_npm2100 *ramp, int result)
+{
+	ramp->running = false;
+	ramp->result = result;
+
+	/* A failed soft-start must not leave LDOSW at the start voltage. A warning still stops
+	 * it, as for any other ramp.
+	 */
+	if (ramp->soft_starting && (result < 0) && (result != -ECANCELED)) {
+		(void)regulator_npm2100_set_voltage_idx(ramp->dev, ramp->config->source,
+							ramp->target);
+	}
+
+	ramp->soft_starting = false;
+
+	if ((ramp->vt != NULL) && (ramp->config->done != NULL)) {
+		ramp->config->done(ramp, result, ramp->config->user_data);
+	}
+}
+
+static void step_handler(struct vtimer_npm2100 *vt, struct vtimer_npm2100_timer *timer,
+			 void *user_data)
+{
+	struct ramp_npm2100 *ramp = user_data;
+	int ret;
+
+	ret = advance(ramp);
+	if (ret < 0) {
+		finish(ramp, ret);
+		return;
+	}
+
+	if (ramp->idx == ramp->target) {
+		finish(ramp, 0);
+		return;
+	}
+
+	ret = vtimer_npm2100_start(vt, timer, ramp->interval_ms, step_handler, ramp);
+	if (ret < 0) {
+		finish(ramp, ret);
+	}
+}
+
+/* Poll for latched stop events, they are left latched */
+static int poll_stop(struct ramp_npm2100 *ramp)
+{
+	uint32_t events;
+	int ret;
+
+	ret = mfd_npm2100_read_events(ramp->dev, &events);
+	if (ret < 0) {
+		return ret;
+	}
+
+	return ((events & RAMP_STOP_EVENTS) != 0U) ? -ECANCELED : 0;
+}
+
+static int ramp_to(struct ramp_npm2100 *ramp, uint8_t from_idx, uint8_t target_idx)
+{
+	int ret;
+
+	ramp->idx = from_idx;
+	ramp->target = target_idx;
+
+	if (from_idx == target_idx) {
+		return 0;
+	}
+
+	ramp->running = true;
+
+	/* A warning not yet handled refuses the ramp, it would otherwise go unnoticed */
+	ret = poll_stop(ramp);
+	if (ret < 0) {
+		finish(ramp, ret);
+		return ret;
+	}
+
+	if (ramp->vt != NULL) {
+		step_handler(ramp->vt, &ramp->timer, ramp);
+
+		/* A failure in the first step ends the ramp at once */
+		return ramp->running ? 0 : ramp->result;
+	}
+
+	while (ret == 0) {
+		ret = advance(ramp);
+		if ((ret < 0) || (ramp->idx == ramp->target)) {
+			break;
+		}
+
+		clock_delay_us(ramp->config->interval_us);
+
+		ret = poll_stop(ramp);
+	}
+
+	finish(ramp, ret);
+
+	return ret;
+}
+
+static int soft_start_prepare(struct i2c_dev *dev, enum npm2100_regulator_source source,
+			      void *user_data)
+{
+	struct ramp_npm2100 *ramp = user_data;
+	int ret;
+
+	(void)dev;
+
+	if ((source != ramp->config->source) || ramp->running) {
+		return 0;
+	}
+
+	/* Remember the set voltage as target, and enable at the start voltage. After a failed
+	 * enable the output is still at the start voltage, keep the target of that attempt.
+	 */
+	if (!ramp->soft_starting) {
+		ret = present_idx(ramp, &ramp->target);
+		if (ret < 0) {
+			return ret;
+		}
+
+		ramp->soft_starting = true;
+	}
+
+	return regulator_npm2100_set_voltage_idx(ramp->dev, source,
+						 MIN(ramp->soft_start_idx, ramp->target));
+}
+
+static int soft_start_start(struct i2c_dev *dev, enum npm2100_regulator_source source,
+			    void *user_data)
+{
+	struct ramp_npm2100 *ramp = user_data;
+	int ret;
+
+	(void)dev;
+
+	if ((source != ramp->config->source) || ramp->running) {
+		return 0;
+	}
+
+	ret = ramp_to(ramp, MIN(ramp->soft_start_idx, ramp->target), ramp->target);
+
+	/* Ended already, at the target or after a failure */
+	if (!ramp->running) {
+		ramp->soft_starting = false;
+	}
+
+	return ret;
+}
+
+int ramp_npm2100_init(struct ramp_npm2100 *ramp, struct i2c_dev *dev,
+		      const struct ramp_npm2100_config *config, struct vtimer_npm2100 *vt)
+{
+	const uint32_t step_uv = (config->source == NPM2100_SOURCE_BOOST) ? NPM2100_BOOST_STEP_UV
+									  : NPM2100_LDOSW_STEP_UV;
+	uint32_t interval_us = config->interval_us;
+	uint64_t step_idx;
+
+	if ((config->slew_uv_per_ms == 0U) || (config->interval_us == 0U)) {
+		return -EINVAL;
+	}
+
+	ramp->dev = dev;
+	ramp->config = config;
+	ramp->vt = vt;
+	ramp->timer = (struct vtimer_npm2100_timer){0};
+	ramp->running = false;
+	ramp->soft_starting = false;
+	ramp->result = 0;
+
+	/* The PMIC timer paces in whole ms, and no faster than its tick */
+	ramp->interval_ms = DIV_ROUND_UP(interval_us, 1000U);
+	if (vt != NULL) {
+		ramp->interval_ms = MAX(ramp->interval_ms, RAMP_VT_INTERVAL_MIN_MS);
+		interval_us = ramp->interval_ms * 1000U;
+	}
+
+	/* Indices per write, at least one */
+	step_idx = (uint64_t)config->slew_uv_per_ms * interval_us / 1000U / step_uv;
+	ramp->step = (uint8_t)CLAMP(step_idx, 1U, UINT8_MAX);
+
+	return mfd_npm2100_enable_events(dev, RAMP_STOP_EVENTS);
+}
+
+int ramp_npm2100_start(struct ramp_npm2100 *ramp, uint8_t target_idx)
+{
+	uint8_t idx;
+	int ret;
+
+	if (ramp->running) {
+		return -EBUSY;
+	}
+
+	if (!idx_valid(ramp, target_idx)) {
+		return -EINVAL;
+	}
+
+	ret = present_idx(ramp, &idx);
+	if (ret < 0) {
+		return ret;
+	}
+
+	return ramp_to(ramp, idx, target_idx);
+}
+
+int ramp_npm2100_process_events(struct ramp_npm2100 *ramp, uint32_t events)
+{
+	int ret;
+
+	if (((events & RAMP_STOP_EVENTS) == 0U) || !ramp->running) {
+		return 0;
+	}
+
+	/* The blocking loop polls for the events itself */
+	if (ramp->vt == NULL) {
+		return 0;
+	}
+
+	ret = vtimer_npm2100_stop(ramp->vt, &ramp->timer);
+	finish(ramp, -ECANCELED);
+
+	return ret;
+}
+
+int ramp_npm2100_soft_start(struct ramp_npm2100 *ramp, uint8_t start_idx)
+{
+	if ((ramp->config->source != NPM2100_SOURCE_LDOSW) || !idx_valid(ramp, start_idx)) {
+		return -EINVAL;
+	}
+
+	ramp->soft_start_idx = start_idx;
+	ramp->soft_start.prepare = soft_start_prepare;
+	ramp->soft_start.start = soft_start_start;
+	ramp->soft_start.user_data = ramp;
+	regulator_npm2100_set_soft_start(&ramp->soft_start);
+
+	return 0;
+}
+
+bool ramp_npm2100_is_running(const struct ramp_npm2100 *ramp)
+{
+	return ramp->running;
+}
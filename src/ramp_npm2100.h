@@ -0,0 +1,127 @@
+/** @file
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef RAMP_NPM2100_H_
+#define RAMP_NPM2100_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "i2c.h"
+#include "regulator_npm2100.h"
+#include "vtimer_npm2100.h"
+
+struct ramp_npm2100;
+
+/**
+ * @brief Voltage ramp configuration
+ *
+ * The configuration can be declared const so it is placed in flash.
+ */
+struct ramp_npm2100_config {
+	enum npm2100_regulator_source source;
+	/* maximum output voltage change rate */
+	uint32_t slew_uv_per_ms;
+	/* time between index writes. When paced by the PMIC timer it is rounded up to whole ms,
+	 * and to at least one timer tick (16 ms)
+	 */
+	uint32_t interval_us;
+	/* optional, called when an asynchronous ramp ends, with 0 if the target was reached or
+	 * -ECANCELED if it was stopped by a warning event
+	 */
+	void (*done)(struct ramp_npm2100 *ramp, int result, void *user_data);
+	/* user context passed to the hook */
+	void *user_data;
+};
+
+/**
+ * @brief Voltage ramp
+ *
+ * Fields are private.
+ */
+struct ramp_npm2100 {
+	struct i2c_dev *dev;
+	const struct ramp_npm2100_config *config;
+	struct vtimer_npm2100 *vt;
+	struct vtimer_npm2100_timer timer;
+	struct regulator_npm2100_soft_start soft_start;
+	uint32_t interval_ms;
+	uint8_t step;
+	uint8_t idx;
+	uint8_t target;
+	uint8_t soft_start_idx;
+	bool soft_starting;
+	int result;
+	volatile bool running;
+};
+
+/**
+ * @brief Initialise voltage ramp
+ *
+ * Enables the boost VOUT WARN and VBAT WARN events, which stop a ramp in progress.
+ *
+ * @param ramp voltage ramp.
+ * @param dev device pointer, passed to i2c hal layer.
+ * @param config regulator and slew rate.
+ * @param vt virtual timer service pacing the ramp on the PMIC timer, or NULL to pace it on the
+ * host clock and block until the ramp ends. Needs capacity for one more timer.
+ * @return 0 on success, -EINVAL if the slew rate or interval is 0, -errno on bus failure
+ */
+int ramp_npm2100_init(struct ramp_npm2100 *ramp, struct i2c_dev *dev,
+		      const struct ramp_npm2100_config *config, struct vtimer_npm2100 *vt);
+
+/**
+ * @brief Ramp the output voltage to a register index
+ *
+ * Starts from the index of the present output voltage. Each write moves the index by as many
+ * steps as the slew rate allows within one interval. Without a virtual timer service, returns
+ * when the ramp ends, and reads the event registers between steps to stop on a warning. Events
+ * are left latched for mfd_npm2100_process_events. A warning still latched at the start, not
+ * yet cleared by mfd_npm2100_process_events, refuses the ramp with -ECANCELED.
+ *
+ * @param ramp voltage ramp.
+ * @param target_idx target register index, e.g. from NPM2100_BOOST_UV_TO_IDX.
+ * @return 0 on success, -EBUSY if a ramp is in progress, -EINVAL if the index is out of range,
+ * -ECANCELED if a warning is latched or a blocking ramp was stopped by one, -errno if a blocking
+ * ramp or the first step of an asynchronous ramp failed
+ */
+int ramp_npm2100_start(struct ramp_npm2100 *ramp, uint8_t target_idx);
+
+/**
+ * @brief Stop ramp on warning events
+ *
+ * Should be called with every event bitfield returned by mfd_npm2100_process_events. The
+ * output is left at the last written index.
+ *
+ * @param ramp voltage ramp.
+ * @param events bitfield of events (bits are defined by mfd_npm2100_event_t).
+ * @return 0 on success, -errno on bus failure
+ */
+int ramp_npm2100_process_events(struct ramp_npm2100 *ramp, uint32_t events);
+
+/**
+ * @brief Soft-start LDOSW on every enable
+ *
+ * Installs a regulator soft-start hook. regulator_npm2100_enable then sets a disabled LDOSW
+ * to @p start_idx before enabling it, and ramps it to the previously set voltage. The ramp must
+ * be configured for LDOSW. If the ramp fails other than by a warning, LDOSW is set to the
+ * previous voltage at once, and the error is returned from regulator_npm2100_enable or passed
+ * to the done hook.
+ *
+ * @param ramp voltage ramp.
+ * @param start_idx LDOSW register index at enable, e.g. from NPM2100_LDOSW_UV_TO_IDX.
+ * @return 0 on success, -EINVAL if the ramp is not for LDOSW or the index is out of range
+ */
+int ramp_npm2100_soft_start(struct ramp_npm2100 *ramp, uint8_t start_idx);
+
+/**
+ * @brief Check whether a ramp is in progress
+ *
+ * @param ramp voltage ramp.
+ * @return true if running
+ */
+bool ramp_npm2100_is_running(const struct ramp_npm2100 *ramp);
+
+#endif /* RAMP_NPM2100_H_ */
@@ -10,7 +10,9 @@
 
 #include "i2c.h"
 #include "linear_range.h"
+#include "mfd_npm2100.h"
 #include "regulator_npm2100.h"
+#include "util.h"
 
 #define BOOST_VOUT     0x22U
 #define BOOST_VOUTSEL  0x23U
@@ -36,25 +38,28 @@
 
 #define SHIP_TASK_SHIP 0xC0U
 
-#define BOOST_OPER_MODE_MASK 0x07U
-#define BOOST_OPER_MODE_AUTO 0x00U
-#define BOOST_OPER_MODE_HP   0x01U
-#define BOOST_OPER_MODE_LP   0x02U
-#define BOOST_OPER_MODE_PASS 0x03U
-#define BOOST_OPER_MODE_NOHP 0x04U
+#define BOOST_STATUS1_VSET_MASK 0x40U
 
-#define BOOST_PIN_FORCE_HP   0x00U
-#define BOOST_PIN_FORCE_LP   0x01U
-#define BOOST_PIN_FORCE_PASS 0x03U
-#define BOOST_PIN_FORCE_NOHP 0x04U
+/* Cached registers, bits of cache.valid */
+#define CACHE_VOUTSEL    BIT(0)
+#define CACHE_BOOST_VOUT BIT(1)
+#define CACHE_LDOSW_VOUT BIT(2)
+#define CACHE_STATUS1    BIT(3)
+#define CACHE_VSET       BIT(4)
+#define CACHE_LDOSW_EN   BIT(5)
 
-#define BOOST_STATUS1_VSET_MASK 0x40U
+/* Events after which the boost status may have changed */
+#define CACHE_STATUS1_EVENTS                                                                       \
+	(BIT(NPM2100_EVENT_BOOST_VBAT_WARN) | BIT(NPM2100_EVENT_BOOST_VOUT_MIN) |                  \
+	 BIT(NPM2100_EVENT_BOOST_VOUT_WARN) | BIT(NPM2100_EVENT_BOOST_VOUT_DPS) |                  \
+	 BIT(NPM2100_EVENT_BOOST_VOUT_OK))
+
+/* Events after which LDOSW may have been switched off */
+#define CACHE_LDOSW_EN_EVENTS                                                                      \
+	(BIT(NPM2100_EVENT_LDOSW_OCP) | BIT(NPM2100_EVENT_LDOSW_VINTFAIL))
 
-#define LDOSW_SEL_OPER_MASK 0x06U
-#define LDOSW_SEL_OPER_AUTO 0x00U
-#define LDOSW_SEL_OPER_ULP  0x02U
-#define LDOSW_SEL_OPER_HP   0x04U
-#define LDOSW_SEL_OPER_PIN  0x06U
+/* Events after which the VSET pin may select another voltage */
+#define VSET_EVENTS (BIT(NPM2100_EVENT_BOOST_VOUT_DPS) | BIT(NPM2100_EVENT_BOOST_VOUT_OK))
 
 #define LDOSW_GPIO_PIN_MASK     0x07U
 #define LDOSW_GPIO_PINACT_MASK  0x18U
@@ -63,12 +68,226 @@
 #define LDOSW_GPIO_PININACT_OFF 0x00U
 #define LDOSW_GPIO_PININACT_ULP 0x10U
 
-static const struct linear_range boost_range = LINEAR_RANGE_INIT(1800000, 50000, 0U, 30U);
-static const struct linear_range ldosw_range = LINEAR_RANGE_INIT(800000, 50000, 8U, 52U);
-static const struct linear_range vset0_range = LINEAR_RANGE_INIT(1800000, 100000, 0U, 6U);
-static const struct linear_range vset1_ranges[] = {LINEAR_RANGE_INIT(3000000, 0, 0U, 0U),
-						   LINEAR_RANGE_INIT(2700000, 100000, 1U, 3U),
-						   LINEAR_RANGE_INIT(3100000, 100000, 4U, 6U)};
+#define BOOST_IDX_MAX NPM2100_BOOST_UV_TO_IDX(NPM2100_BOOST_MAX_UV)
+#define LDOSW_IDX_MAX NPM2100_LDOSW_UV_TO_IDX(NPM2100_LDOSW_MAX_UV)
+
+BUILD_ASSERT(BOOST_IDX_MAX == 30U);
+BUILD_ASSERT(LDOSW_IDX_MAX == 52U);
+
+static const struct linear_range boost_range =
+	LINEAR_RANGE_INIT(NPM2100_BOOST_MIN_UV, NPM2100_BOOST_STEP_UV, 0U, BOOST_IDX_MAX);
+static const struct linear_range ldosw_range = LINEAR_RANGE_INIT(
+	NPM2100_LDOSW_MIN_UV, NPM2100_LDOSW_STEP_UV, NPM2100_LDOSW_MIN_IDX, LDOSW_IDX_MAX);
+
+/* VSET pin voltages, indexed by the BOOST_VSET0 and BOOST_VSET1 register values */
+static const int32_t vset0_uv[] = {1800000, 1900000, 2000000, 2100000, 2200000, 2300000, 2400000};
+static const int32_t vset1_uv[] = {3000000, 2700000, 2800000, 2900000, 3100000, 3200000, 3300000};
+
+/* Register cache, VSET0 and VSET1 are fixed after boot, the others are written by this driver
+ * or refreshed after events
+ */
+static struct {
+	uint8_t valid;
+	uint8_t voutsel;
+	uint8_t boost_vout;
+	uint8_t ldosw_vout;
+	uint8_t ldosw_enable;
+	/* BOOST_STATUS1, BOOST_VSET0, BOOST_VSET1 */
+	uint8_t status1_vset[BOOST_VSET1 - BOOST_STATUS1 + 1U];
+	/* last VSET pin voltage reported to listeners, 0 if none */
+	int32_t vset_uv;
+} cache;
+
+static struct regulator_npm2100_listener *listeners;
+static const struct regulator_npm2100_soft_start *soft_start;
+
+static inline void notify(struct i2c_dev *dev, enum npm2100_regulator_source source,
+		   enum regulator_npm2100_change change, int32_t value)
+{
+	for (struct regulator_npm2100_listener *l = listeners; l != NULL; l = l->next) {
+		l->changed(dev, source, change, value, l->user_data);
+	}
+}
+
+static int cached_read(struct i2c_dev *dev, uint8_t flag, uint8_t reg, uint8_t *value)
+{
+	int ret;
+
+	if ((cache.valid & flag) != 0U) {
+		return 0;
+	}
+
+	ret = i2c_reg_read_byte(dev, reg, value);
+	if (ret < 0) {
+		return ret;
+	}
+
+	cache.valid |= flag;
+
+	return 0;
+}
+
+/* Write a cached register, skipped if the cached value is already equal */
+static int cached_write(struct i2c_dev *dev, uint8_t flag, uint8_t reg, uint8_t *cached,
+			uint8_t value)
+{
+	int ret;
+
+	if (((cache.valid & flag) != 0U) && (*cached == value)) {
+		return 0;
+	}
+
+	cache.valid &= ~flag;
+
+	ret = i2c_reg_write_byte(dev, reg, value);
+	if (ret < 0) {
+		return ret;
+	}
+
+	*cached = value;
+	cache.valid |= flag;
+
+	return 0;
+}
+
+/* Refresh BOOST_STATUS1, together with BOOST_VSET0 and BOOST_VSET1 on first use */
+static int cached_read_vset(struct i2c_dev *dev)
+{
+	int ret;
+
+	if ((cache.valid & CACHE_VSET) == 0U) {
+		ret = i2c_read(dev, BOOST_STATUS1, cache.status1_vset, sizeof(cache.status1_vset));
+		if (ret < 0) {
+			return ret;
+		}
+
+		cache.valid |= CACHE_STATUS1 | CACHE_VSET;
+
+		return 0;
+	}
+
+	return cached_read(dev, CACHE_STATUS1, BOOST_STATUS1, &cache.status1_vset[0]);
+}
+
+static inline int vset_lookup(const int32_t *table, size_t size, uint8_t idx, int32_t *volt_uv)
+{
+	if (idx >= size) {
+		return -EINVAL;
+	}
+
+	*volt_uv = table[idx];
+
+	return 0;
+}
+
+void regulator_npm2100_add_listener(struct regulator_npm2100_listener *listener)
+{
+	/* Linking a listener twice would make the list circular */
+	for (struct regulator_npm2100_listener *l = listeners; l != NULL; l = l->next) {
+		if (l == listener) {
+			return;
+		}
+	}
+
+	listener->next = listeners;
+	listeners = listener;
+}
+
+void regulator_npm2100_remove_listener(struct regulator_npm2100_listener *listener)
+{
+	for (struct regulator_npm2100_listener **l = &listeners; *l != NULL; l = &(*l)->next) {
+		if (*l == listener) {
+			*l = listener->next;
+			listener->next = NULL;
+			return;
+		}
+	}
+}
+
+static int get_vset_voltage(struct i2c_dev *dev, int32_t *volt_uv)
+{
+	int ret;
+
+	ret = cached_read_vset(dev);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if ((cache.status1_vset[0] & BOOST_STATUS1_VSET_MASK) == 0U) {
+		/* VSET low, voltage is selected by VSET0 register */
+		return vset_lookup(vset0_uv, ARRAY_SIZE(vset0_uv),
+				   cache.status1_vset[BOOST_VSET0 - BOOST_STATUS1], volt_uv);
+	}
+
+	/* VSET high, voltage is selected by VSET1 register */
+	return vset_lookup(vset1_uv, ARRAY_SIZE(vset1_uv),
+			   cache.status1_vset[BOOST_VSET1 - BOOST_STATUS1], volt_uv);
+}
+
+/* Re-read the VSET pin state, and report a changed boost voltage to listeners */
+static int vset_refresh(struct i2c_dev *dev)
+{
+	int32_t volt_uv;
+	int ret;
+
+	ret = cached_read(dev, CACHE_VOUTSEL, BOOST_VOUTSEL, &cache.voutsel);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (cache.voutsel == NPM2100_BOOST_VOUTSEL_REGISTER) {
+		return 0;
+	}
+
+	cache.valid &= ~CACHE_STATUS1;
+
+	ret = get_vset_voltage(dev, &volt_uv);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (volt_uv != cache.vset_uv) {
+		cache.vset_uv = volt_uv;
+		notify(dev, NPM2100_SOURCE_BOOST, REGULATOR_NPM2100_CHANGE_VOLTAGE, volt_uv);
+	}
+
+	return 0;
+}
+
+void regulator_npm2100_set_soft_start(const struct regulator_npm2100_soft_start *hook)
+{
+	soft_start = hook;
+}
+
+int regulator_npm2100_init(struct i2c_dev *dev)
+{
+	uint8_t buf[BOOST_VOUTSEL - BOOST_VOUT + 1U];
+	int ret;
+
+	cache.valid = 0U;
+	cache.vset_uv = 0;
+
+	ret = i2c_read(dev, BOOST_VOUT, buf, sizeof(buf));
+	if (ret < 0) {
+		return ret;
+	}
+
+	cache.boost_vout = buf[0];
+	cache.voutsel = buf[BOOST_VOUTSEL - BOOST_VOUT];
+	cache.valid |= CACHE_BOOST_VOUT | CACHE_VOUTSEL;
+
+	if (cache.voutsel == NPM2100_BOOST_VOUTSEL_REGISTER) {
+		return 0;
+	}
+
+	/* Voltage is selected by VSET pin, read the pin state and both VSET voltages */
+	return get_vset_voltage(dev, &cache.vset_uv);
+}
+
+int regulator_npm2100_vset_changed(struct i2c_dev *dev)
+{
+	return vset_refresh(dev);
+}
 
 int regulator_npm2100_set_voltage(struct i2c_dev *dev, enum npm2100_regulator_source source, int32_t min_uv,
 				  int32_t max_uv)
@@ -79,85 +298,98 @@ int regulator_npm2100_set_voltage(struct i2c_dev *dev, enum npm2100_regulator_so
 	switch (source) {
 	case NPM2100_SOURCE_BOOST:
 		ret = linear_range_get_win_index(&boost_range, min_uv, max_uv, &idx);
-		if (ret == -EINVAL) {
-			return ret;
+		break;
+	case NPM2100_SOURCE_LDOSW:
+		ret = linear_range_get_win_index(&ldosw_range, min_uv, max_uv, &idx);
+		break;
+	default:
+		return -ENODEV;
+	}
+
+	if (ret == -EINVAL) {
+		return ret;
+	}
+
+	return regulator_npm2100_set_voltage_idx(dev, source, idx);
+}
+
+int regulator_npm2100_set_voltage_idx(struct i2c_dev *dev, enum npm2100_regulator_source source,
+				      uint8_t idx)
+{
+	int32_t volt_uv;
+	int ret;
+
+	switch (source) {
+	case NPM2100_SOURCE_BOOST:
+		if (idx > BOOST_IDX_MAX) {
+			return -EINVAL;
 		}
 
-		ret = i2c_reg_write_byte(dev, BOOST_VOUT, idx);
+		ret = cached_write(dev, CACHE_BOOST_VOUT, BOOST_VOUT, &cache.boost_vout, idx);
 		if (ret < 0) {
 			return ret;
 		}
 
 		/* Enable SW control of boost voltage */
-		return i2c_reg_write_byte(dev, BOOST_VOUTSEL, 1U);
+		ret = cached_write(dev, CACHE_VOUTSEL, BOOST_VOUTSEL, &cache.voutsel,
+				   NPM2100_BOOST_VOUTSEL_REGISTER);
+		volt_uv = NPM2100_BOOST_MIN_UV + (int32_t)idx * NPM2100_BOOST_STEP_UV;
+		break;
 
 	case NPM2100_SOURCE_LDOSW:
-		ret = linear_range_get_win_index(&ldosw_range, min_uv, max_uv, &idx);
-		if (ret == -EINVAL) {
-			return ret;
+		if ((idx < NPM2100_LDOSW_MIN_IDX) || (idx > LDOSW_IDX_MAX)) {
+			return -EINVAL;
 		}
 
-		return i2c_reg_write_byte(dev, LDOSW_VOUT, idx);
+		ret = cached_write(dev, CACHE_LDOSW_VOUT, LDOSW_VOUT, &cache.ldosw_vout, idx);
+		volt_uv = NPM2100_LDOSW_MIN_UV +
+			  (int32_t)(idx - NPM2100_LDOSW_MIN_IDX) * NPM2100_LDOSW_STEP_UV;
+		break;
 
 	default:
 		return -ENODEV;
 	}
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	notify(dev, source, REGULATOR_NPM2100_CHANGE_VOLTAGE, volt_uv);
+
+	return 0;
 }
 
 int regulator_npm2100_get_voltage(struct i2c_dev *dev, enum npm2100_regulator_source source, int32_t *volt_uv)
 {
-	uint8_t idx;
 	int ret;
 
 	switch (source) {
 	case NPM2100_SOURCE_BOOST:
-		ret = i2c_reg_read_byte(dev, BOOST_VOUTSEL, &idx);
+		ret = cached_read(dev, CACHE_VOUTSEL, BOOST_VOUTSEL, &cache.voutsel);
 		if (ret < 0) {
 			return ret;
 		}
 
-		if (idx == 1U) {
+		if (cache.voutsel == NPM2100_BOOST_VOUTSEL_REGISTER) {
 			/* Voltage is selected by register value */
-			ret = i2c_reg_read_byte(dev, BOOST_VOUT, &idx);
+			ret = cached_read(dev, CACHE_BOOST_VOUT, BOOST_VOUT, &cache.boost_vout);
 			if (ret < 0) {
 				return ret;
 			}
 
-			return linear_range_get_value(&boost_range, idx, volt_uv);
+			return linear_range_get_value(&boost_range, cache.boost_vout, volt_uv);
 		}
 
 		/* Voltage is selected by VSET pin */
-		ret = i2c_reg_read_byte(dev, BOOST_STATUS1, &idx);
-		if (ret < 0) {
-			return ret;
-		}
-
-		if ((idx & BOOST_STATUS1_VSET_MASK) == 0U) {
-			/* VSET low, voltage is selected by VSET0 register */
-			ret = i2c_reg_read_byte(dev, BOOST_VSET0, &idx);
-			if (ret < 0) {
-				return ret;
-			}
-
-			return linear_range_get_value(&vset0_range, idx, volt_uv);
-		}
-
-		/* VSET high, voltage is selected by VSET1 register */
-		ret = i2c_reg_read_byte(dev, BOOST_VSET1, &idx);
-		if (ret < 0) {
-			return ret;
-		}
-
-		return linear_range_group_get_value(vset1_ranges, ARRAY_SIZE(vset1_ranges), idx,
-						    volt_uv);
+		return get_vset_voltage(dev, volt_uv);
 
 	case NPM2100_SOURCE_LDOSW:
-		ret = i2c_reg_read_byte(dev, LDOSW_VOUT, &idx);
+		ret = cached_read(dev, CACHE_LDOSW_VOUT, LDOSW_VOUT, &cache.ldosw_vout);
 		if (ret < 0) {
 			return ret;
 		}
 
-		return linear_range_get_value(&ldosw_range, idx, volt_uv);
+		return linear_range_get_value(&ldosw_range, cache.ldosw_vout, volt_uv);
 
 	default:
 		return -ENODEV;
@@ -171,19 +403,19 @@ static int set_boost_mode(struct i2c_dev *dev, uint16_t mode)
 
 	switch (mode & NPM2100_REG_OPER_MASK) {
 	case NPM2100_REG_OPER_AUTO:
-		reg = BOOST_OPER_MODE_AUTO;
+		reg = NPM2100_BOOST_OPER_MODE_AUTO;
 		break;
 	case NPM2100_REG_OPER_HP:
-		reg = BOOST_OPER_MODE_HP;
+		reg = NPM2100_BOOST_OPER_MODE_HP;
 		break;
 	case NPM2100_REG_OPER_LP:
-		reg = BOOST_OPER_MODE_LP;
+		reg = NPM2100_BOOST_OPER_MODE_LP;
 		break;
 	case NPM2100_REG_OPER_PASS:
-		reg = BOOST_OPER_MODE_PASS;
+		reg = NPM2100_BOOST_OPER_MODE_PASS;
 		break;
 	case NPM2100_REG_OPER_NOHP:
-		reg = BOOST_OPER_MODE_NOHP;
+		reg = NPM2100_BOOST_OPER_MODE_NOHP;
 		break;
 	default:
 		return -ENOTSUP;
@@ -198,16 +430,16 @@ static int set_boost_mode(struct i2c_dev *dev, uint16_t mode)
 	case 0U:
 		return 0;
 	case NPM2100_REG_FORCE_HP:
-		reg = BOOST_PIN_FORCE_HP;
+		reg = NPM2100_BOOST_PIN_FORCE_HP;
 		break;
 	case NPM2100_REG_FORCE_LP:
-		reg = BOOST_PIN_FORCE_LP;
+		reg = NPM2100_BOOST_PIN_FORCE_LP;
 		break;
 	case NPM2100_REG_FORCE_PASS:
-		reg = BOOST_PIN_FORCE_PASS;
+		reg = NPM2100_BOOST_PIN_FORCE_PASS;
 		break;
 	case NPM2100_REG_FORCE_NOHP:
-		reg = BOOST_PIN_FORCE_NOHP;
+		reg = NPM2100_BOOST_PIN_FORCE_NOHP;
 		break;
 	default:
 		return -ENOTSUP;
@@ -226,7 +458,7 @@ static int set_ldosw_gpio_mode(struct i2c_dev *dev, uint8_t inact, uint8_t act,
 	}
 
 	/* Set operating mode to pin control */
-	return i2c_reg_write_byte(dev, LDOSW_SEL, LDOSW_SEL_OPER_PIN | ldsw);
+	return i2c_reg_write_byte(dev, LDOSW_SEL, NPM2100_LDOSW_SEL_OPER_PIN | ldsw);
 }
 
 static int set_ldosw_mode(struct i2c_dev *dev, uint8_t mode)
@@ -239,11 +471,11 @@ static int set_ldosw_mode(struct i2c_dev *dev, uint8_t mode)
 		/* SW control of mode */
 		switch (oper) {
 		case NPM2100_REG_OPER_AUTO:
-			return i2c_reg_write_byte(dev, LDOSW_SEL, LDOSW_SEL_OPER_AUTO | ldsw);
+			return i2c_reg_write_byte(dev, LDOSW_SEL, NPM2100_LDOSW_SEL_OPER_AUTO | ldsw);
 		case NPM2100_REG_OPER_ULP:
-			return i2c_reg_write_byte(dev, LDOSW_SEL, LDOSW_SEL_OPER_ULP | ldsw);
+			return i2c_reg_write_byte(dev, LDOSW_SEL, NPM2100_LDOSW_SEL_OPER_ULP | ldsw);
 		case NPM2100_REG_OPER_HP:
-			return i2c_reg_write_byte(dev, LDOSW_SEL, LDOSW_SEL_OPER_HP | ldsw);
+			return i2c_reg_write_byte(dev, LDOSW_SEL, NPM2100_LDOSW_SEL_OPER_HP | ldsw);
 		default:
 			return -ENOTSUP;
 		}
@@ -266,32 +498,180 @@ static int set_ldosw_mode(struct i2c_dev *dev, uint8_t mode)
 
 int regulator_npm2100_set_mode(struct i2c_dev *dev, enum npm2100_regulator_source source, uint16_t mode)
 {
+	int ret;
+
 	switch (source) {
 	case NPM2100_SOURCE_BOOST:
-		return set_boost_mode(dev, mode);
+		ret = set_boost_mode(dev, mode);
+		break;
 	case NPM2100_SOURCE_LDOSW:
-		return set_ldosw_mode(dev, mode);
+		ret = set_ldosw_mode(dev, mode);
+		break;
 	default:
 		return -ENODEV;
 	}
+
+	if (ret == 0) {
+		notify(dev, source, REGULATOR_NPM2100_CHANGE_MODE, mode);
+	}
+
+	return ret;
 }
 
-int regulator_npm2100_enable(struct i2c_dev *dev, enum npm2100_regulator_source source)
+/* Mode setting of a BOOST_OPER register value */
+static uint16_t boost_mode(uint8_t oper)
 {
-	if (source != NPM2100_SOURCE_LDOSW) {
+	switch (oper & NPM2100_BOOST_OPER_MODE_MASK) {
+	case NPM2100_BOOST_OPER_MODE_HP:
+		return NPM2100_REG_OPER_HP;
+	case NPM2100_BOOST_OPER_MODE_LP:
+		return NPM2100_REG_OPER_LP;
+	case NPM2100_BOOST_OPER_MODE_PASS:
+		return NPM2100_REG_OPER_PASS;
+	case NPM2100_BOOST_OPER_MODE_NOHP:
+		return NPM2100_REG_OPER_NOHP;
+	default:
+		return NPM2100_REG_OPER_AUTO;
+	}
+}
+
+/* Mode setting of LDOSW_SEL and LDOSW_GPIO register values, the latter only used in pin mode */
+static uint16_t ldosw_mode(uint8_t sel, uint8_t gpio)
+{
+	uint16_t ldsw = sel & NPM2100_REG_LDSW_EN;
+	uint16_t oper;
+	uint16_t force;
+
+	switch (sel & NPM2100_LDOSW_SEL_OPER_MASK) {
+	case NPM2100_LDOSW_SEL_OPER_ULP:
+		return NPM2100_REG_OPER_ULP | ldsw;
+	case NPM2100_LDOSW_SEL_OPER_HP:
+		return NPM2100_REG_OPER_HP | ldsw;
+	case NPM2100_LDOSW_SEL_OPER_PIN:
+		break;
+	default:
+		return NPM2100_REG_OPER_AUTO | ldsw;
+	}
+
+	oper = ((gpio & LDOSW_GPIO_PININACT_ULP) != 0U) ? NPM2100_REG_OPER_ULP
+							 : NPM2100_REG_OPER_OFF;
+	force = ((gpio & LDOSW_GPIO_PINACT_ULP) != 0U) ? NPM2100_REG_FORCE_ULP
+						       : NPM2100_REG_FORCE_HP;
+
+	return oper | force | ldsw;
+}
+
+int regulator_npm2100_get_mode(struct i2c_dev *dev, enum npm2100_regulator_source source,
+			       uint16_t *mode)
+{
+	/* LDOSW_SEL, LDOSW_GPIO */
+	uint8_t buf[LDOSW_GPIO - LDOSW_SEL + 1U];
+	int ret;
+
+	switch (source) {
+	case NPM2100_SOURCE_BOOST:
+		ret = i2c_reg_read_byte(dev, BOOST_OPER, &buf[0]);
+		if (ret < 0) {
+			return ret;
+		}
+
+		*mode = boost_mode(buf[0]);
 		return 0;
+
+	case NPM2100_SOURCE_LDOSW:
+		ret = i2c_read(dev, LDOSW_SEL, buf, sizeof(buf));
+		if (ret < 0) {
+			return ret;
+		}
+
+		*mode = ldosw_mode(buf[0], buf[LDOSW_GPIO - LDOSW_SEL]);
+		return 0;
+
+	default:
+		return -ENODEV;
 	}
+}
+
+int regulator_npm2100_is_enabled(struct i2c_dev *dev, enum npm2100_regulator_source source,
+				 bool *enabled)
+{
+	int ret;
+
+	switch (source) {
+	case NPM2100_SOURCE_BOOST:
+		/* Boost cannot be disabled */
+		*enabled = true;
+		return 0;
+
+	case NPM2100_SOURCE_LDOSW:
+		ret = cached_read(dev, CACHE_LDOSW_EN, LDOSW_ENABLE, &cache.ldosw_enable);
+		if (ret < 0) {
+			return ret;
+		}
 
-	return i2c_reg_write_byte(dev, LDOSW_ENABLE, 1U);
+		*enabled = (cache.ldosw_enable & 1U) != 0U;
+		return 0;
+
+	default:
+		return -ENODEV;
+	}
 }
 
-int regulator_npm2100_disable(struct i2c_dev *dev, enum npm2100_regulator_source source)
+static int set_enable(struct i2c_dev *dev, enum npm2100_regulator_source source, bool enable)
 {
+	bool soft = false;
+	bool enabled;
+	int ret;
+
 	if (source != NPM2100_SOURCE_LDOSW) {
 		return 0;
 	}
 
-	return i2c_reg_write_byte(dev, LDOSW_ENABLE, 0U);
+	/* Soft-start only from off, a live rail must not drop to the start voltage */
+	if (enable && (soft_start != NULL)) {
+		ret = regulator_npm2100_is_enabled(dev, source, &enabled);
+		if (ret < 0) {
+			return ret;
+		}
+
+		soft = !enabled;
+	}
+
+	if (soft) {
+		ret = soft_start->prepare(dev, source, soft_start->user_data);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	/* Always written, LDOSW may have been switched off without the cache knowing */
+	cache.valid &= ~CACHE_LDOSW_EN;
+
+	ret = i2c_reg_write_byte(dev, LDOSW_ENABLE, enable ? 1U : 0U);
+	if (ret < 0) {
+		return ret;
+	}
+
+	cache.ldosw_enable = enable ? 1U : 0U;
+	cache.valid |= CACHE_LDOSW_EN;
+
+	notify(dev, source, REGULATOR_NPM2100_CHANGE_ENABLE, enable ? 1 : 0);
+
+	if (soft) {
+		return soft_start->start(dev, source, soft_start->user_data);
+	}
+
+	return 0;
+}
+
+int regulator_npm2100_enable(struct i2c_dev *dev, enum npm2100_regulator_source source)
+{
+	return set_enable(dev, source, true);
+}
+
+int regulator_npm2100_disable(struct i2c_dev *dev, enum npm2100_regulator_source source)
+{
+	return set_enable(dev, source, false);
 }
 
 int regulator_npm2100_pin_ctrl(struct i2c_dev *dev, enum npm2100_regulator_source source, uint8_t gpio_pin,
@@ -310,6 +690,120 @@ int regulator_npm2100_pin_ctrl(struct i2c_dev *dev, enum npm2100_regulator_sourc
 	}
 }
 
+int regulator_npm2100_process_events(struct i2c_dev *dev, uint32_t events)
+{
+	if ((events & CACHE_STATUS1_EVENTS) != 0U) {
+		cache.valid &= ~CACHE_STATUS1;
+	}
+
+	if ((events & CACHE_LDOSW_EN_EVENTS) != 0U) {
+		cache.valid &= ~CACHE_LDOSW_EN;
+	}
+
+	/* Without listeners the new VSET state is read on the next get_voltage */
+	if (((events & VSET_EVENTS) == 0U) || (listeners == NULL)) {
+		return 0;
+	}
+
+	return vset_refresh(dev);
+}
+
+/* Register r is within the written block starting at reg */
+static inline bool written(uint8_t reg, size_t len, uint8_t r)
+{
+	return (r >= reg) && ((size_t)(r - reg) < len);
+}
+
+int regulator_npm2100_registers_written(struct i2c_dev *dev, uint8_t reg, const uint8_t *values,
+					size_t len)
+{
+	int32_t volt_uv;
+	uint8_t sel_gpio[LDOSW_GPIO - LDOSW_SEL + 1U] = {0};
+	int ret;
+
+	if (written(reg, len, BOOST_VOUT)) {
+		cache.boost_vout = values[BOOST_VOUT - reg];
+		cache.valid |= CACHE_BOOST_VOUT;
+	}
+
+	if (written(reg, len, BOOST_VOUTSEL)) {
+		cache.voutsel = values[BOOST_VOUTSEL - reg];
+		cache.valid |= CACHE_VOUTSEL;
+	}
+
+	if (written(reg, len, LDOSW_VOUT)) {
+		cache.ldosw_vout = values[LDOSW_VOUT - reg];
+		cache.valid |= CACHE_LDOSW_VOUT;
+	}
+
+	if (written(reg, len, LDOSW_ENABLE)) {
+		cache.ldosw_enable = values[LDOSW_ENABLE - reg];
+		cache.valid |= CACHE_LDOSW_EN;
+	}
+
+	if (listeners == NULL) {
+		return 0;
+	}
+
+	if (written(reg, len, BOOST_VOUT) || written(reg, len, BOOST_VOUTSEL)) {
+		ret = regulator_npm2100_get_voltage(dev, NPM2100_SOURCE_BOOST, &volt_uv);
+		if (ret < 0) {
+			return ret;
+		}
+
+		if (cache.voutsel != NPM2100_BOOST_VOUTSEL_REGISTER) {
+			cache.vset_uv = volt_uv;
+		}
+
+		notify(dev, NPM2100_SOURCE_BOOST, REGULATOR_NPM2100_CHANGE_VOLTAGE, volt_uv);
+	}
+
+	if (written(reg, len, BOOST_OPER)) {
+		notify(dev, NPM2100_SOURCE_BOOST, REGULATOR_NPM2100_CHANGE_MODE,
+		       boost_mode(values[BOOST_OPER - reg]));
+	}
+
+	if (written(reg, len, LDOSW_VOUT) &&
+	    (linear_range_get_value(&ldosw_range, cache.ldosw_vout, &volt_uv) == 0)) {
+		notify(dev, NPM2100_SOURCE_LDOSW, REGULATOR_NPM2100_CHANGE_VOLTAGE, volt_uv);
+	}
+
+	if (written(reg, len, LDOSW_ENABLE)) {
+		notify(dev, NPM2100_SOURCE_LDOSW, REGULATOR_NPM2100_CHANGE_ENABLE,
+		       values[LDOSW_ENABLE - reg] & 1U);
+	}
+
+	if (written(reg, len, LDOSW_SEL) || written(reg, len, LDOSW_GPIO)) {
+		/* Read the register not written, LDOSW_GPIO only matters in pin mode */
+		if (!written(reg, len, LDOSW_SEL) ||
+		    (!written(reg, len, LDOSW_GPIO) &&
+		     ((values[LDOSW_SEL - reg] & NPM2100_LDOSW_SEL_OPER_MASK) == NPM2100_LDOSW_SEL_OPER_PIN))) {
+			ret = i2c_read(dev, LDOSW_SEL, sel_gpio, sizeof(sel_gpio));
+			if (ret < 0) {
+				return ret;
+			}
+		}
+
+		for (uint8_t r = LDOSW_SEL; r <= LDOSW_GPIO; r++) {
+			if (written(reg, len, r)) {
+				sel_gpio[r - LDOSW_SEL] = values[r - reg];
+			}
+		}
+
+		notify(dev, NPM2100_SOURCE_LDOSW, REGULATOR_NPM2100_CHANGE_MODE,
+		       ldosw_mode(sel_gpio[0], sel_gpio[LDOSW_GPIO - LDOSW_SEL]));
+	}
+
+	return 0;
+}
+
+void regulator_npm2100_invalidate_cache(struct i2c_dev *dev)
+{
+	(void)dev;
+
+	cache.valid = 0U;
+}
+
 int regulator_npm2100_ship_mode(struct i2c_dev *dev)
 {
 	return i2c_reg_write_byte(dev, SHIP_TASK_SHIP, 1U);
@@ -6,10 +6,12 @@
 #ifndef REGULATOR_NPM2100_H_
 #define REGULATOR_NPM2100_H_
 
+#include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
 
 #include "i2c.h"
+#include "util.h"
 
 /* nPM2100 voltage sources */
 enum npm2100_regulator_source {
@@ -38,12 +40,163 @@ enum npm2100_regulator_source {
 #define NPM2100_REG_FORCE_PASS 0x40U
 #define NPM2100_REG_FORCE_NOHP 0x50U
 
+/* Register encodings of the boost voltage selection and operating modes, for register
+ * programs built at compile time
+ */
+#define NPM2100_BOOST_VOUTSEL_REGISTER 1U
+
+#define NPM2100_BOOST_OPER_MODE_MASK 0x07U
+#define NPM2100_BOOST_OPER_MODE_AUTO 0x00U
+#define NPM2100_BOOST_OPER_MODE_HP   0x01U
+#define NPM2100_BOOST_OPER_MODE_LP   0x02U
+#define NPM2100_BOOST_OPER_MODE_PASS 0x03U
+#define NPM2100_BOOST_OPER_MODE_NOHP 0x04U
+
+#define NPM2100_BOOST_PIN_FORCE_HP   0x00U
+#define NPM2100_BOOST_PIN_FORCE_LP   0x01U
+#define NPM2100_BOOST_PIN_FORCE_PASS 0x03U
+#define NPM2100_BOOST_PIN_FORCE_NOHP 0x04U
+
+#define NPM2100_LDOSW_SEL_OPER_MASK 0x06U
+#define NPM2100_LDOSW_SEL_OPER_AUTO 0x00U
+#define NPM2100_LDOSW_SEL_OPER_ULP  0x02U
+#define NPM2100_LDOSW_SEL_OPER_HP   0x04U
+#define NPM2100_LDOSW_SEL_OPER_PIN  0x06U
+
+/* Boost output voltage range */
+#define NPM2100_BOOST_MIN_UV  1800000
+#define NPM2100_BOOST_MAX_UV  3300000
+#define NPM2100_BOOST_STEP_UV 50000
+
+/* LDOSW output voltage range, register indices start above 0 */
+#define NPM2100_LDOSW_MIN_UV  800000
+#define NPM2100_LDOSW_MAX_UV  3000000
+#define NPM2100_LDOSW_STEP_UV 50000
+#define NPM2100_LDOSW_MIN_IDX 8
+
+/**
+ * @brief Convert a decimal voltage literal to microvolts at build time.
+ *
+ * The argument must be a plain literal, e.g. NPM2100_V_TO_UV(2.5). The result is an integer
+ * constant expression, usable in static initializers and case labels.
+ */
+#define NPM2100_V_TO_UV(v) ((int32_t)v##e6)
+
+/**
+ * @brief Convert a constant voltage to a boost register index at build time.
+ *
+ * Rounds up to the next supported voltage, like @ref regulator_npm2100_set_voltage. A voltage
+ * outside the boost range fails to compile.
+ *
+ * @param uv Voltage in microvolts, an integer constant expression.
+ */
+#define NPM2100_BOOST_UV_TO_IDX(uv)                                                                \
+	((uint8_t)(DIV_ROUND_UP((uv) - NPM2100_BOOST_MIN_UV, NPM2100_BOOST_STEP_UV) +              \
+		   ZERO_OR_COMPILE_ERROR(((uv) >= NPM2100_BOOST_MIN_UV) &&                         \
+					 ((uv) <= NPM2100_BOOST_MAX_UV))))
+
+/**
+ * @brief Convert a constant voltage to a LDOSW register index at build time.
+ *
+ * Rounds up to the next supported voltage, like @ref regulator_npm2100_set_voltage. A voltage
+ * outside the LDOSW range fails to compile.
+ *
+ * @param uv Voltage in microvolts, an integer constant expression.
+ */
+#define NPM2100_LDOSW_UV_TO_IDX(uv)                                                                \
+	((uint8_t)(NPM2100_LDOSW_MIN_IDX +                                                         \
+		   DIV_ROUND_UP((uv) - NPM2100_LDOSW_MIN_UV, NPM2100_LDOSW_STEP_UV) +              \
+		   ZERO_OR_COMPILE_ERROR(((uv) >= NPM2100_LDOSW_MIN_UV) &&                         \
+					 ((uv) <= NPM2100_LDOSW_MAX_UV))))
+
+/* Regulator setting reported to listeners */
+enum regulator_npm2100_change {
+	REGULATOR_NPM2100_CHANGE_MODE,    /* value is the mode, see regulator_npm2100_set_mode */
+	REGULATOR_NPM2100_CHANGE_VOLTAGE, /* value is the output voltage in microvolts */
+	REGULATOR_NPM2100_CHANGE_ENABLE,  /* value is 1 if enabled, 0 if disabled */
+};
+
+/**
+ * @brief Regulator change listener
+ *
+ * Storage is owned by the caller and must stay valid while registered.
+ */
+struct regulator_npm2100_listener {
+	/* called after a setting was written */
+	void (*changed)(struct i2c_dev *dev, enum npm2100_regulator_source source,
+			enum regulator_npm2100_change change, int32_t value, void *user_data);
+	/* user context passed to the callback */
+	void *user_data;
+	/* private */
+	struct regulator_npm2100_listener *next;
+};
+
+/**
+ * @brief Register a regulator change listener.
+ *
+ * Listeners are called after every successful mode, voltage or enable setting made through
+ * this driver or reported with @ref regulator_npm2100_registers_written, and when a VSET pin
+ * change alters the boost voltage. Without listeners, the
+ * cost per setting is one pointer check. Registering a listener that is already registered
+ * has no effect.
+ *
+ * @param listener listener to register.
+ */
+void regulator_npm2100_add_listener(struct regulator_npm2100_listener *listener);
+
+/**
+ * @brief Unregister a regulator change listener.
+ *
+ * The listener storage may be reused once this returns. Unregistering a listener that is not
+ * registered has no effect.
+ *
+ * @param listener listener to unregister.
+ */
+void regulator_npm2100_remove_listener(struct regulator_npm2100_listener *listener);
+
+/**
+ * @brief LDOSW soft-start hook
+ *
+ * The configuration can be declared const so it is placed in flash.
+ */
+struct regulator_npm2100_soft_start {
+	/* called before LDOSW is enabled, e.g. to lower its voltage */
+	int (*prepare)(struct i2c_dev *dev, enum npm2100_regulator_source source, void *user_data);
+	/* called after LDOSW was enabled, e.g. to ramp to the final voltage */
+	int (*start)(struct i2c_dev *dev, enum npm2100_regulator_source source, void *user_data);
+	/* user context passed to the hooks */
+	void *user_data;
+};
+
+/**
+ * @brief Install a LDOSW soft-start hook.
+ *
+ * The hook is called from @ref regulator_npm2100_enable while LDOSW is disabled. An error
+ * returned by start is returned from @ref regulator_npm2100_enable.
+ *
+ * @param hook soft-start hook, or NULL to remove it.
+ */
+void regulator_npm2100_set_soft_start(const struct regulator_npm2100_soft_start *hook);
+
+/**
+ * @brief Initialise regulator state cache.
+ *
+ * Detects whether the boost voltage is selected by register or by VSET pin, and reads the
+ * selected voltage settings, so that later voltage queries need no bus access.
+ *
+ * @param dev device pointer, passed to i2c hal layer.
+ *
+ * @return 0 If successful, -errno In case of bus error
+ */
+int regulator_npm2100_init(struct i2c_dev *dev);
+
 /**
  * @brief Set the output voltage.
  *
  * The output voltage will be configured to the closest supported output
  * voltage. regulator_get_voltage() can be used to obtain the actual configured
  * voltage. The voltage will be applied to the active or selected mode.
+ * Registers already holding the requested value are not written again.
  *
  * @param dev device pointer, passed to i2c hal layer.
  * @param source regulator source identifier.
@@ -55,9 +208,29 @@ enum npm2100_regulator_source {
 int regulator_npm2100_set_voltage(struct i2c_dev *dev, enum npm2100_regulator_source source, int32_t min_uv,
 				  int32_t max_uv);
 
+/**
+ * @brief Set the output voltage by register index.
+ *
+ * Skips the voltage to index conversion, for indices computed at build time with
+ * NPM2100_BOOST_UV_TO_IDX or NPM2100_LDOSW_UV_TO_IDX. Registers already holding the requested
+ * value are not written again.
+ *
+ * @param dev device pointer, passed to i2c hal layer.
+ * @param source regulator source identifier.
+ * @param idx Register index.
+ *
+ * @return 0 If successful, -EINVAL If the index is out of range, -errno In case of bus error
+ */
+int regulator_npm2100_set_voltage_idx(struct i2c_dev *dev, enum npm2100_regulator_source source,
+				      uint8_t idx);
+
 /**
  * @brief Obtain output voltage.
  *
+ * Register values are cached: voltages written by this driver, the VSET0 and VSET1 values
+ * which are fixed after boot, and the boost status, which is refreshed after boost events
+ * passed to @ref regulator_npm2100_process_events. In steady state no bus access is needed.
+ *
  * @param dev device pointer, passed to i2c hal layer.
  * @param source regulator source identifier.
  * @param[out] volt_uv Where configured output voltage will be stored.
@@ -70,10 +243,13 @@ int regulator_npm2100_get_voltage(struct i2c_dev *dev, enum npm2100_regulator_so
 /**
  * @brief Enable a regulator.
  *
+ * LDOSW is soft-started if a hook was installed with @ref regulator_npm2100_set_soft_start and
+ * LDOSW is disabled. An enabled LDOSW is only written again.
+ *
  * @param dev device pointer, passed to i2c hal layer.
  * @param source regulator source identifier.
  *
- * @return 0 If successful, -errno In case of bus error
+ * @return 0 If successful, -errno In case of bus error or soft-start failure
  */
 int regulator_npm2100_enable(struct i2c_dev *dev, enum npm2100_regulator_source source);
 
@@ -87,6 +263,63 @@ int regulator_npm2100_enable(struct i2c_dev *dev, enum npm2100_regulator_source
  */
 int regulator_npm2100_disable(struct i2c_dev *dev, enum npm2100_regulator_source source);
 
+/**
+ * @brief Update regulator state cache on events.
+ *
+ * Should be called with every event bitfield returned by mfd_npm2100_process_events. The boost
+ * events must be enabled for the cached boost status to be refreshed, and a LDOSW fault event
+ * makes the cached LDOSW enable state be read again. Makes no bus access,
+ * unless listeners are registered and a boost VOUT OK or DPS event may come from a VSET pin
+ * change. The VSET pin state is then read, and a changed boost voltage is reported.
+ *
+ * @param dev device pointer, passed to i2c hal layer.
+ * @param events bitfield of events (bits are defined by mfd_npm2100_event_t).
+ *
+ * @return 0 If successful, -errno In case of bus error
+ */
+int regulator_npm2100_process_events(struct i2c_dev *dev, uint32_t events);
+
+/**
+ * @brief Report a VSET pin change.
+ *
+ * For hosts that drive the VSET pin, or otherwise know it changed. Reads the VSET pin state and
+ * reports a changed boost voltage to listeners. Nothing is read while the boost voltage is
+ * selected by register.
+ *
+ * @param dev device pointer, passed to i2c hal layer.
+ *
+ * @return 0 If successful, -errno In case of bus error
+ */
+int regulator_npm2100_vset_changed(struct i2c_dev *dev);
+
+/**
+ * @brief Report regulator registers written by other means.
+ *
+ * For modules that write regulator registers directly, such as power profiles. Updates the
+ * state cache from the written values, and reports the mode, voltage and enable settings
+ * written to listeners. Registers that do not belong to the regulators are ignored. With
+ * listeners, LDOSW_SEL and LDOSW_GPIO are read when the values written do not determine the
+ * LDOSW mode. The boost force mode is not reported.
+ *
+ * @param dev device pointer, passed to i2c hal layer.
+ * @param reg address of the first register written.
+ * @param values values written to consecutive registers.
+ * @param len number of registers written.
+ *
+ * @return 0 If successful, -errno In case of bus error
+ */
+int regulator_npm2100_registers_written(struct i2c_dev *dev, uint8_t reg, const uint8_t *values,
+					size_t len);
+
+/**
+ * @brief Invalidate regulator state cache.
+ *
+ * Needed after the nPM2100 was reset, or its regulator registers were written by other means.
+ *
+ * @param dev device pointer, passed to i2c hal layer.
+ */
+void regulator_npm2100_invalidate_cache(struct i2c_dev *dev);
+
 /**
  * @brief Enter ship mode.
  *
@@ -130,4 +363,34 @@ int regulator_npm2100_pin_ctrl(struct i2c_dev *dev, enum npm2100_regulator_sourc
  */
 int regulator_npm2100_set_mode(struct i2c_dev *dev, enum npm2100_regulator_source source, uint16_t mode);
 
+/**
+ * @brief Obtain the configured regulator mode.
+ *
+ * Reads the mode registers, the result uses the encoding of @ref regulator_npm2100_set_mode.
+ * The boost force mode is not reported.
+ *
+ * @param dev device pointer, passed to i2c hal layer.
+ * @param source regulator source identifier.
+ * @param[out] mode Where the mode will be stored.
+ *
+ * @return 0 If successful, -errno In case of bus error
+ */
+int regulator_npm2100_get_mode(struct i2c_dev *dev, enum npm2100_regulator_source source,
+			       uint16_t *mode);
+
+/**
+ * @brief Check whether a regulator is enabled.
+ *
+ * The LDOSW enable register is cached. It is read again after a LDOSW fault event passed to
+ * @ref regulator_npm2100_process_events. Boost is always enabled.
+ *
+ * @param dev device pointer, passed to i2c hal layer.
+ * @param source regulator source identifier.
+ * @param[out] enabled Where the enable state will be stored.
+ *
+ * @return 0 If successful, -errno In case of bus error
+ */
+int regulator_npm2100_is_enabled(struct i2c_dev *dev, enum npm2100_regulator_source source,
+				 bool *enabled);
+
 #endif /* REGULATOR_NPM2100_H_*/
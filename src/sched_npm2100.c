@@ -0,0 +1,150 @@
+/** @file
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "clock.h"
+#include "i2c.h"
+#include "regulator_npm2100.h"
+#include "sched_npm2100.h"
+#include "util.h"
+
+static inline bool time_before(uint32_t a, uint32_t b)
+{
+	return (int32_t)(a - b) < 0;
+}
+
+/* Switch a regulator mode, and record how long the write took on the bus */
+static int transition(struct sched_npm2100 *sched, enum npm2100_regulator_source source,
+		      uint16_t mode)
+{
+	uint32_t start = clock_get_us();
+	int ret;
+
+	ret = regulator_npm2100_set_mode(sched->dev, source, mode);
+	if (ret < 0) {
+		return ret;
+	}
+
+	sched->transitions++;
+	sched->max_write_us[source] = MAX(sched->max_write_us[source], clock_get_us() - start);
+
+	return 0;
+}
+
+int sched_npm2100_init(struct sched_npm2100 *sched, struct i2c_dev *dev,
+		       const struct sched_npm2100_config *config,
+		       struct sched_npm2100_activity *activities, uint8_t capacity)
+{
+	sched->dev = dev;
+	sched->config = config;
+	sched->activities = activities;
+	sched->capacity = capacity;
+	sched->count = 0U;
+	sched->transitions = 0U;
+	sched->late = 0U;
+
+	for (unsigned int i = 0U; i < SCHED_NPM2100_SOURCES; i++) {
+		int ret;
+
+		sched->active[i] = false;
+		sched->max_write_us[i] = 0U;
+
+		ret = regulator_npm2100_set_mode(dev, i, config->idle_mode[i]);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+int sched_npm2100_add(struct sched_npm2100 *sched, const struct sched_npm2100_activity *activity)
+{
+	if (activity->source >= SCHED_NPM2100_SOURCES) {
+		return -EINVAL;
+	}
+
+	if (sched->count >= sched->capacity) {
+		return -ENOMEM;
+	}
+
+	sched->activities[sched->count++] = *activity;
+
+	return 0;
+}
+
+int sched_npm2100_run(struct sched_npm2100 *sched, uint32_t *next_ms)
+{
+	uint32_t now = clock_get_ms();
+	uint32_t next = UINT32_MAX;
+	bool wanted[SCHED_NPM2100_SOURCES] = {false};
+	bool starting[SCHED_NPM2100_SOURCES] = {false};
+	uint8_t i = 0U;
+
+	while (i < sched->count) {
+		const struct sched_npm2100_activity *activity = &sched->activities[i];
+		uint32_t end = activity->start_ms + activity->duration_ms;
+		uint32_t lead = DIV_ROUND_UP(sched->config->lead_us[activity->source], 1000U);
+		uint32_t switch_at = activity->start_ms - lead;
+
+		if (!time_before(now, end)) {
+			/* Finished, replace with the last activity */
+			sched->activities[i] = sched->activities[--sched->count];
+			continue;
+		}
+
+		if (time_before(now, switch_at)) {
+			next = MIN(next, switch_at - now);
+		} else {
+			wanted[activity->source] = true;
+			next = MIN(next, end - now);
+			if (!sched->active[activity->source] &&
+			    !time_before(now, activity->start_ms)) {
+				starting[activity->source] = true;
+			}
+		}
+
+		i++;
+	}
+
+	for (unsigned int src = 0U; src < SCHED_NPM2100_SOURCES; src++) {
+		int ret;
+
+		if (wanted[src] == sched->active[src]) {
+			continue;
+		}
+
+		ret = transition(sched, src,
+				 wanted[src] ? sched->config->active_mode[src]
+					     : sched->config->idle_mode[src]);
+		if (ret < 0) {
+			return ret;
+		}
+
+		sched->active[src] = wanted[src];
+
+		if (wanted[src] && starting[src]) {
+			sched->late++;
+		}
+	}
+
+	*next_ms = next;
+
+	return 0;
+}
+
+void sched_npm2100_get_stats(const struct sched_npm2100 *sched, struct sched_npm2100_stats *stats)
+{
+	stats->transitions = sched->transitions;
+	stats->late = sched->late;
+
+	for (unsigned int i = 0U; i < SCHED_NPM2100_SOURCES; i++) {
+		stats->max_write_us[i] = sched->max_write_us[i];
+	}
+}
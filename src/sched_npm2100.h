@@ -0,0 +1,120 @@
+/** @file
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef SCHED_NPM2100_H_
+#define SCHED_NPM2100_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "i2c.h"
+#include "regulator_npm2100.h"
+
+/* Number of regulator sources handled by the scheduler */
+#define SCHED_NPM2100_SOURCES 2U
+
+/**
+ * @brief Planned activity
+ */
+struct sched_npm2100_activity {
+	uint32_t start_ms;    /* clock_get_ms time the activity starts */
+	uint32_t duration_ms; /* activity duration */
+	enum npm2100_regulator_source source;
+};
+
+/**
+ * @brief Mode scheduler configuration
+ *
+ * The configuration can be declared const so it is placed in flash.
+ */
+struct sched_npm2100_config {
+	/* mode during activities, per source, see regulator_npm2100_set_mode */
+	uint16_t active_mode[SCHED_NPM2100_SOURCES];
+	/* mode between activities, per source */
+	uint16_t idle_mode[SCHED_NPM2100_SOURCES];
+	/* time before an activity at which its active mode is set, per source. The nPM2100
+	 * reports no mode status to measure settling against, so this is the mode write time,
+	 * see max_write_us, plus the regulator settling time from the datasheet and a margin.
+	 */
+	uint32_t lead_us[SCHED_NPM2100_SOURCES];
+};
+
+/**
+ * @brief Mode transition statistics
+ */
+struct sched_npm2100_stats {
+	uint32_t transitions; /* mode changes made */
+	uint32_t late;        /* activities whose active mode was set after their start */
+	uint32_t max_write_us[SCHED_NPM2100_SOURCES]; /* longest mode write on the bus per source */
+};
+
+/**
+ * @brief Mode scheduler
+ *
+ * Switches each regulator to its active mode the configured lead time before a planned
+ * activity, and back to its idle mode once no activity needs it. Fields are private.
+ */
+struct sched_npm2100 {
+	struct i2c_dev *dev;
+	const struct sched_npm2100_config *config;
+	struct sched_npm2100_activity *activities;
+	uint8_t capacity;
+	uint8_t count;
+	bool active[SCHED_NPM2100_SOURCES];
+	uint32_t max_write_us[SCHED_NPM2100_SOURCES];
+	uint32_t transitions;
+	uint32_t late;
+};
+
+/**
+ * @brief Initialise mode scheduler
+ *
+ * Sets both regulators to their idle mode.
+ *
+ * @param sched mode scheduler.
+ * @param dev device pointer, passed to i2c hal layer.
+ * @param config modes and lead times.
+ * @param activities storage for @p capacity planned activities.
+ * @param capacity maximum number of planned activities.
+ * @return 0 on success, -errno on failure
+ */
+int sched_npm2100_init(struct sched_npm2100 *sched, struct i2c_dev *dev,
+		       const struct sched_npm2100_config *config,
+		       struct sched_npm2100_activity *activities, uint8_t capacity);
+
+/**
+ * @brief Add a planned activity
+ *
+ * Activities may overlap and may be added in any order. Call sched_npm2100_run afterwards to
+ * get the updated time of the next transition.
+ *
+ * @param sched mode scheduler.
+ * @param activity activity, copied.
+ * @return 0 on success, -ENOMEM if @p capacity activities are planned, -EINVAL for an
+ * unknown source
+ */
+int sched_npm2100_add(struct sched_npm2100 *sched, const struct sched_npm2100_activity *activity);
+
+/**
+ * @brief Make due mode transitions
+ *
+ * To be called when the time returned in @p next_ms has passed, e.g. from the host idle loop
+ * or a host timer. Finished activities are removed.
+ *
+ * @param sched mode scheduler.
+ * @param[out] next_ms time in ms until the next transition is due, UINT32_MAX if none.
+ * @return 0 on success, -errno on bus failure
+ */
+int sched_npm2100_run(struct sched_npm2100 *sched, uint32_t *next_ms);
+
+/**
+ * @brief Get mode transition statistics
+ *
+ * @param sched mode scheduler.
+ * @param[out] stats Where statistics will be stored.
+ */
+void sched_npm2100_get_stats(const struct sched_npm2100 *sched, struct sched_npm2100_stats *stats);
+
+#endif /* SCHED_NPM2100_H_ */
@@ -0,0 +1,56 @@
+/** @file
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "math_extras.h"
+#include "mfd_npm2100.h"
+#include "stats_npm2100.h"
+#include "util.h"
+
+void stats_npm2100_init(struct stats_npm2100 *stats, uint32_t events)
+{
+	memset(stats, 0, sizeof(*stats));
+	stats->events = events & BIT_MASK(NPM2100_EVENT_MAX);
+}
+
+void stats_npm2100_record(struct stats_npm2100 *stats, uint32_t events, uint32_t timestamp_ms)
+{
+	events &= stats->events;
+
+	while (events != 0U) {
+		struct stats_npm2100_event *stat = &stats->event[u32_count_trailing_zeros(events)];
+
+		/* Clear lowest set bit */
+		events &= events - 1U;
+
+		if (stat->count > 0U) {
+			uint32_t interval = timestamp_ms - stat->last_ms;
+
+			if ((stat->count == 1U) || (interval < stat->min_ms)) {
+				stat->min_ms = interval;
+			}
+			if (interval > stat->max_ms) {
+				stat->max_ms = interval;
+			}
+			stat->sum_ms += interval;
+		}
+
+		stat->last_ms = timestamp_ms;
+		stat->count++;
+	}
+}
+
+uint32_t stats_npm2100_mean_ms(const struct stats_npm2100 *stats, enum mfd_npm2100_event_t event)
+{
+	const struct stats_npm2100_event *stat = &stats->event[event];
+
+	if (stat->count < 2U) {
+		return 0U;
+	}
+
+	return (uint32_t)(stat->sum_ms / (stat->count - 1U));
+}
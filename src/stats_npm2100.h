@@ -0,0 +1,62 @@
+/** @file
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef STATS_NPM2100_H_
+#define STATS_NPM2100_H_
+
+#include <stdint.h>
+
+#include "mfd_npm2100.h"
+
+/**
+ * @brief Statistics of one event
+ *
+ * Inter-arrival times are only valid once count is at least 2.
+ */
+struct stats_npm2100_event {
+	uint32_t count;       /* number of occurrences */
+	uint32_t last_ms;     /* timestamp of last occurrence */
+	uint32_t min_ms;      /* minimum inter-arrival time */
+	uint32_t max_ms;      /* maximum inter-arrival time */
+	uint64_t sum_ms;      /* sum of inter-arrival times */
+};
+
+/**
+ * @brief Event statistics
+ */
+struct stats_npm2100 {
+	uint32_t events; /* bitfield of tracked events (bits are defined by mfd_npm2100_event_t) */
+	struct stats_npm2100_event event[NPM2100_EVENT_MAX];
+};
+
+/**
+ * @brief Reset event statistics
+ *
+ * @param stats statistics to reset.
+ * @param events bitfield of events to track (bits are defined by mfd_npm2100_event_t)
+ */
+void stats_npm2100_init(struct stats_npm2100 *stats, uint32_t events);
+
+/**
+ * @brief Record occurrence of events
+ *
+ * Constant time per active event, only tracked events in the bitfield are visited.
+ *
+ * @param stats event statistics.
+ * @param events bitfield of events that occurred, as returned by mfd_npm2100_process_events
+ * @param timestamp_ms time of occurrence in ms
+ */
+void stats_npm2100_record(struct stats_npm2100 *stats, uint32_t events, uint32_t timestamp_ms);
+
+/**
+ * @brief Get mean inter-arrival time of an event
+ *
+ * @param stats event statistics.
+ * @param event event identifier.
+ * @return Mean inter-arrival time in ms, 0 if fewer than two occurrences were recorded
+ */
+uint32_t stats_npm2100_mean_ms(const struct stats_npm2100 *stats, enum mfd_npm2100_event_t event);
+
+#endif /* STATS_NPM2100_H_ */
@@ -0,0 +1,350 @@
+/** @file
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "clock.h"
+#include "i2c.h"
+#include "mfd_npm2100.h"
+#include "timer_npm2100.h"
+#include "util.h"
+
+/* Poll interval backoff bounds */
+#define POLL_MIN_US 50U
+#define POLL_MAX_US 1000U
+
+/* Period range, from one timer tick to the maximum timer value */
+#define PERIOD_MIN_MS 16U
+#define PERIOD_MAX_MS NPM2100_TIMER_TICKS_TO_MS(NPM2100_TIMER_TICKS_MAX)
+
+/* Timer tick period in us */
+#define TICK_US (1000000U / NPM2100_TIMER_TICK_HZ)
+
+/* Measurement range, at least 1 s and short enough for the us clock not to wrap */
+#define CALIB_MIN_MS 1000U
+#define CALIB_MAX_MS (INT32_MAX / 1000U)
+
+/* Measurements deviating further are discarded */
+#define CALIB_PPM_MAX 50000
+
+/* Weight of a new measurement in the bin average, as a power of two */
+#define CALIB_SHIFT 2
+
+BUILD_ASSERT(TIMER_NPM2100_CALIB_BINS <= 16, "valid bitmask too small");
+
+static inline bool time_before(uint32_t a, uint32_t b)
+{
+	return (int32_t)(a - b) < 0;
+}
+
+int timer_npm2100_wait_idle(struct i2c_dev *dev, uint32_t timeout_us, uint32_t *settle_us)
+{
+	uint32_t start = clock_get_us();
+	uint32_t interval = POLL_MIN_US;
+	uint32_t elapsed;
+	bool idle;
+
+	while (true) {
+		int ret = mfd_npm2100_timer_idle(dev, &idle);
+
+		if (ret < 0) {
+			return ret;
+		}
+
+		elapsed = clock_get_us() - start;
+		if (idle || (elapsed >= timeout_us)) {
+			break;
+		}
+
+		if (interval > timeout_us - elapsed) {
+			interval = timeout_us - elapsed;
+		}
+
+		clock_delay_us(interval);
+
+		interval = (interval < POLL_MAX_US / 2U) ? interval * 2U : POLL_MAX_US;
+	}
+
+	if (settle_us != NULL) {
+		*settle_us = elapsed;
+	}
+
+	return idle ? 0 : -ETIMEDOUT;
+}
+
+int timer_npm2100_reconfigure(struct i2c_dev *dev, uint32_t time_ms,
+			      enum mfd_npm2100_timer_mode mode, uint32_t *settle_us)
+{
+	int ret = mfd_npm2100_stop_timer(dev);
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = timer_npm2100_wait_idle(dev, TIMER_NPM2100_IDLE_TIMEOUT_US, settle_us);
+	if (ret < 0) {
+		return ret;
+	}
+
+	return mfd_npm2100_set_timer(dev, time_ms, mode);
+}
+
+/* Program the timer for the next deadline on the grid and start it */
+static int periodic_program(struct timer_npm2100_periodic *periodic)
+{
+	uint32_t now = clock_get_ms();
+	uint32_t ticks;
+	int ret;
+
+	/* Skip periods that were missed entirely */
+	while (!time_before(now, periodic->deadline_ms)) {
+		periodic->deadline_ms += periodic->period_ms;
+		periodic->overruns++;
+	}
+
+	ticks = mfd_npm2100_timer_ms_to_ticks(periodic->deadline_ms - now);
+	if (ticks == 0U) {
+		ticks = 1U;
+	}
+
+	if (ticks != periodic->ticks) {
+		ret = timer_npm2100_wait_idle(periodic->dev, TIMER_NPM2100_IDLE_TIMEOUT_US, NULL);
+		if (ret < 0) {
+			return ret;
+		}
+
+		ret = mfd_npm2100_set_timer_ticks(periodic->dev, ticks,
+						  NPM2100_TIMER_MODE_GENERAL_PURPOSE);
+		if (ret < 0) {
+			return ret;
+		}
+
+		periodic->ticks = ticks;
+	}
+
+	return mfd_npm2100_start_timer(periodic->dev);
+}
+
+int timer_npm2100_periodic_start(struct timer_npm2100_periodic *periodic, struct i2c_dev *dev,
+				 uint32_t period_ms)
+{
+	int ret;
+
+	if ((period_ms < PERIOD_MIN_MS) || (period_ms > PERIOD_MAX_MS)) {
+		return -EINVAL;
+	}
+
+	periodic->dev = dev;
+	periodic->period_ms = period_ms;
+	periodic->ticks = 0U;
+	periodic->expiries = 0U;
+	periodic->overruns = 0U;
+	periodic->error = 0;
+	periodic->running = false;
+
+	ret = mfd_npm2100_enable_events(dev, BIT(NPM2100_EVENT_SYS_TIMER_EXPIRY));
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = mfd_npm2100_stop_timer(dev);
+	if (ret < 0) {
+		return ret;
+	}
+
+	periodic->deadline_ms = clock_get_ms() + period_ms;
+
+	ret = periodic_program(periodic);
+	if (ret < 0) {
+		return ret;
+	}
+
+	periodic->running = true;
+
+	return 0;
+}
+
+int timer_npm2100_periodic_restart(struct timer_npm2100_periodic *periodic)
+{
+	if (!periodic->running) {
+		return 0;
+	}
+
+	periodic->expiries++;
+	periodic->deadline_ms += periodic->period_ms;
+
+	return periodic_program(periodic);
+}
+
+int timer_npm2100_periodic_stop(struct timer_npm2100_periodic *periodic)
+{
+	periodic->running = false;
+
+	return mfd_npm2100_stop_timer(periodic->dev);
+}
+
+void timer_npm2100_periodic_expiry_handler(struct i2c_dev *dev, enum mfd_npm2100_event_t event,
+					   void *user_data)
+{
+	struct timer_npm2100_periodic *periodic = user_data;
+	int ret;
+
+	(void)dev;
+	(void)event;
+
+	ret = timer_npm2100_periodic_restart(periodic);
+	if (ret < 0) {
+		/* The timer is not running, no further expiry will come */
+		periodic->running = false;
+		periodic->error = ret;
+	}
+}
+
+int timer_npm2100_periodic_error(const struct timer_npm2100_periodic *periodic)
+{
+	return periodic->error;
+}
+
+static int calib_bin(int32_t temp_udegc)
+{
+	int32_t bin = (temp_udegc - TIMER_NPM2100_CALIB_TEMP_MIN * 1000000) /
+		      (TIMER_NPM2100_CALIB_TEMP_STEP * 1000000);
+
+	return CLAMP(bin, 0, TIMER_NPM2100_CALIB_BINS - 1);
+}
+
+void timer_npm2100_calib_init(struct timer_npm2100_calib *calib, struct i2c_dev *dev)
+{
+	calib->dev = dev;
+	calib->running = false;
+	calib->valid = 0U;
+
+	for (int i = 0; i < TIMER_NPM2100_CALIB_BINS; i++) {
+		calib->ppm[i] = 0;
+	}
+}
+
+int timer_npm2100_calib_start(struct timer_npm2100_calib *calib, uint32_t duration_ms)
+{
+	uint32_t ticks = DIV_ROUND_CLOSEST(duration_ms * NPM2100_TIMER_TICK_HZ, 1000U);
+	int ret;
+
+	if ((duration_ms < CALIB_MIN_MS) || (duration_ms > CALIB_MAX_MS)) {
+		return -EINVAL;
+	}
+
+	calib->running = false;
+
+	ret = mfd_npm2100_enable_events(calib->dev, BIT(NPM2100_EVENT_SYS_TIMER_EXPIRY));
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = mfd_npm2100_stop_timer(calib->dev);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = timer_npm2100_wait_idle(calib->dev, TIMER_NPM2100_IDLE_TIMEOUT_US, NULL);
+	if (ret < 0) {
+		return ret;
+	}
+
+	/* Tick-denominated, so the current correction does not bias the measurement */
+	ret = mfd_npm2100_set_timer_ticks(calib->dev, ticks, NPM2100_TIMER_MODE_GENERAL_PURPOSE);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = mfd_npm2100_start_timer(calib->dev);
+	if (ret < 0) {
+		return ret;
+	}
+
+	/* The timer starts counting when the start task write completes */
+	calib->start_us = clock_get_us();
+	calib->expected_us = ticks * TICK_US;
+	calib->running = true;
+
+	return 0;
+}
+
+int timer_npm2100_calib_expired(struct timer_npm2100_calib *calib, uint32_t timestamp_us,
+				int32_t temp_udegc, int32_t *ppm)
+{
+	uint32_t measured_us = timestamp_us - calib->start_us;
+	int64_t sample;
+	int bin;
+
+	if (!calib->running) {
+		return -EALREADY;
+	}
+
+	calib->running = false;
+
+	if (measured_us == 0U) {
+		return -ERANGE;
+	}
+
+	/* A fast oscillator expires early: positive deviation */
+	sample = DIV_ROUND_CLOSEST(((int64_t)calib->expected_us - measured_us) * 1000000,
+				   (int64_t)measured_us);
+	if ((sample > CALIB_PPM_MAX) || (sample < -CALIB_PPM_MAX)) {
+		return -ERANGE;
+	}
+
+	bin = calib_bin(temp_udegc);
+	if ((calib->valid & BIT(bin)) == 0U) {
+		calib->ppm[bin] = (int32_t)sample;
+		calib->valid |= BIT(bin);
+	} else {
+		calib->ppm[bin] += ((int32_t)sample - calib->ppm[bin]) / (1 << CALIB_SHIFT);
+	}
+
+	if (ppm != NULL) {
+		*ppm = (int32_t)sample;
+	}
+
+	return 0;
+}
+
+int32_t timer_npm2100_calib_ppm(const struct timer_npm2100_calib *calib, int32_t temp_udegc)
+{
+	int bin = calib_bin(temp_udegc);
+	int lo = bin;
+	int hi = bin;
+
+	if (calib->valid == 0U) {
+		return 0;
+	}
+
+	if ((calib->valid & BIT(bin)) != 0U) {
+		return calib->ppm[bin];
+	}
+
+	while ((lo >= 0) && ((calib->valid & BIT(lo)) == 0U)) {
+		lo--;
+	}
+	while ((hi < TIMER_NPM2100_CALIB_BINS) && ((calib->valid & BIT(hi)) == 0U)) {
+		hi++;
+	}
+
+	if (lo < 0) {
+		return calib->ppm[hi];
+	}
+	if (hi >= TIMER_NPM2100_CALIB_BINS) {
+		return calib->ppm[lo];
+	}
+
+	return calib->ppm[lo] + (calib->ppm[hi] - calib->ppm[lo]) * (bin - lo) / (hi - lo);
+}
+
+void timer_npm2100_calib_apply(const struct timer_npm2100_calib *calib, int32_t temp_udegc)
+{
+	mfd_npm2100_set_timer_ppm(timer_npm2100_calib_ppm(calib, temp_udegc));
+}
@@ -0,0 +1,206 @@
+/** @file
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef TIMER_NPM2100_H_
+#define TIMER_NPM2100_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "i2c.h"
+#include "mfd_npm2100.h"
+
+/* Default bound for waiting on the timer to turn idle */
+#define TIMER_NPM2100_IDLE_TIMEOUT_US 10000U
+
+/**
+ * @brief Wait for npm2100 timer to turn idle
+ *
+ * Polls the timer status with exponential backoff, starting with a short interval so that
+ * a timer which settles quickly costs little time, and bounded by @p timeout_us.
+ *
+ * @param dev device pointer, passed to i2c hal layer.
+ * @param timeout_us maximum time to wait in us.
+ * @param[out] settle_us optional, time it took for the timer to turn idle in us.
+ * @return 0 If successful, -ETIMEDOUT if the timer did not turn idle in time,
+ * -errno In case of any bus error
+ */
+int timer_npm2100_wait_idle(struct i2c_dev *dev, uint32_t timeout_us, uint32_t *settle_us);
+
+/**
+ * @brief Reconfigure npm2100 timer
+ *
+ * Stops the timer, waits for it to turn idle, and writes the new timer value and mode.
+ * The timer is not started, use @ref mfd_npm2100_start_timer.
+ *
+ * @param dev device pointer, passed to i2c hal layer.
+ * @param time_ms timer value in ms
+ * @param mode timer mode
+ * @param[out] settle_us optional, time it took for the timer to turn idle in us.
+ * @return 0 If successful, -EINVAL if time value is too large, -ETIMEDOUT if the timer did not
+ * turn idle within TIMER_NPM2100_IDLE_TIMEOUT_US, -errno In case of any bus error
+ */
+int timer_npm2100_reconfigure(struct i2c_dev *dev, uint32_t time_ms,
+			      enum mfd_npm2100_timer_mode mode, uint32_t *settle_us);
+
+/**
+ * @brief Periodic timer
+ *
+ * Expiries are scheduled on an absolute host time grid of period_ms, so neither the rounding
+ * of each period to whole timer ticks nor the restart latency accumulates over time.
+ * Fields are private.
+ */
+struct timer_npm2100_periodic {
+	struct i2c_dev *dev;
+	uint32_t period_ms;
+	uint32_t deadline_ms;
+	uint32_t ticks;
+	uint32_t expiries;
+	uint32_t overruns;
+	int error;
+	bool running;
+};
+
+/**
+ * @brief Start periodic timer
+ *
+ * Enables the timer expiry event. Each expiry must be passed to
+ * timer_npm2100_periodic_restart, either directly or through
+ * timer_npm2100_periodic_expiry_handler in an event callback table.
+ *
+ * @param periodic periodic timer.
+ * @param dev device pointer, passed to i2c hal layer.
+ * @param period_ms period in ms, at least one timer tick (16 ms).
+ * @return 0 If successful, -EINVAL if the period is out of range, -errno In case of any error
+ */
+int timer_npm2100_periodic_start(struct timer_npm2100_periodic *periodic, struct i2c_dev *dev,
+				 uint32_t period_ms);
+
+/**
+ * @brief Restart periodic timer after expiry
+ *
+ * Should be called as early as possible after the expiry event. If the next period needs the
+ * same number of ticks as the previous one, only the start task is written. Periods that were
+ * missed entirely are skipped and counted as overruns.
+ *
+ * @param periodic periodic timer.
+ * @return 0 If successful, -errno In case of any error
+ */
+int timer_npm2100_periodic_restart(struct timer_npm2100_periodic *periodic);
+
+/**
+ * @brief Stop periodic timer
+ *
+ * @param periodic periodic timer.
+ * @return 0 If successful, -errno In case of any bus error
+ */
+int timer_npm2100_periodic_stop(struct timer_npm2100_periodic *periodic);
+
+/**
+ * @brief Timer expiry event handler
+ *
+ * Can be registered for NPM2100_EVENT_SYS_TIMER_EXPIRY in an event callback table, with the
+ * periodic timer as user data. It should be the first handler to run in the dispatch. A failed
+ * restart stops the periodic timer, see timer_npm2100_periodic_error.
+ */
+void timer_npm2100_periodic_expiry_handler(struct i2c_dev *dev, enum mfd_npm2100_event_t event,
+					   void *user_data);
+
+/**
+ * @brief Get the error that stopped the periodic timer in the expiry handler
+ *
+ * The expiry handler cannot return the error of a failed restart, and the timer does not expire
+ * again after it. Start the periodic timer again to recover.
+ *
+ * @param periodic periodic timer.
+ * @return 0 if no restart failed since the periodic timer was started, -errno otherwise
+ */
+int timer_npm2100_periodic_error(const struct timer_npm2100_periodic *periodic);
+
+/* Die temperature range and bin width of the calibration table, in degrees C */
+#define TIMER_NPM2100_CALIB_TEMP_MIN  -40
+#define TIMER_NPM2100_CALIB_TEMP_STEP 10
+#define TIMER_NPM2100_CALIB_BINS      14
+
+/**
+ * @brief Timer calibration
+ *
+ * Tracks the deviation of the timer oscillator from its nominal frequency per die temperature
+ * bin, measured against the host clock. Fields are private.
+ */
+struct timer_npm2100_calib {
+	struct i2c_dev *dev;
+	uint32_t start_us;
+	uint32_t expected_us;
+	bool running;
+	uint16_t valid;
+	int32_t ppm[TIMER_NPM2100_CALIB_BINS];
+};
+
+/**
+ * @brief Initialise timer calibration
+ *
+ * Clears all calibration bins.
+ *
+ * @param calib timer calibration.
+ * @param dev device pointer, passed to i2c hal layer.
+ */
+void timer_npm2100_calib_init(struct timer_npm2100_calib *calib, struct i2c_dev *dev);
+
+/**
+ * @brief Start a timer calibration measurement
+ *
+ * Enables the timer expiry event and starts the timer in general purpose mode, uncorrected.
+ * The measurement is completed by timer_npm2100_calib_expired. The timer must not be used for
+ * anything else until then. Longer measurements are less sensitive to the expiry timestamp
+ * latency: 1 ms over 10 s is 100 ppm.
+ *
+ * @param calib timer calibration.
+ * @param duration_ms measurement duration in ms.
+ * @return 0 If successful, -EINVAL if the duration is out of range, -errno In case of any error
+ */
+int timer_npm2100_calib_start(struct timer_npm2100_calib *calib, uint32_t duration_ms);
+
+/**
+ * @brief Complete a timer calibration measurement
+ *
+ * The measured deviation is averaged into the bin for @p temp_udegc.
+ *
+ * @param calib timer calibration.
+ * @param timestamp_us host clock_get_us time of the timer expiry, preferably taken at the
+ * interrupt pin edge, see irq_npm2100_notify_time_us.
+ * @param temp_udegc die temperature in micro degrees C, as returned by adc_npm2100_get_result.
+ * @param[out] ppm optional, measured deviation in parts per million.
+ * @return 0 If successful, -EALREADY if no measurement is running, -ERANGE if the measurement is
+ * implausible and was discarded
+ */
+int timer_npm2100_calib_expired(struct timer_npm2100_calib *calib, uint32_t timestamp_us,
+				int32_t temp_udegc, int32_t *ppm);
+
+/**
+ * @brief Get timer oscillator deviation at a die temperature
+ *
+ * Uses the bin for @p temp_udegc if measured, interpolates linearly between the nearest
+ * measured bins around it otherwise, or uses the nearest measured bin outside the measured
+ * range.
+ *
+ * @param calib timer calibration.
+ * @param temp_udegc die temperature in micro degrees C.
+ * @return Deviation in parts per million, 0 if no bin was measured
+ */
+int32_t timer_npm2100_calib_ppm(const struct timer_npm2100_calib *calib, int32_t temp_udegc);
+
+/**
+ * @brief Apply timer calibration for a die temperature
+ *
+ * Sets the correction used by mfd_npm2100_set_timer and mfd_npm2100_hibernate. Should be
+ * called again whenever the die temperature changes significantly.
+ *
+ * @param calib timer calibration.
+ * @param temp_udegc die temperature in micro degrees C.
+ */
+void timer_npm2100_calib_apply(const struct timer_npm2100_calib *calib, int32_t temp_udegc);
+
+#endif /* TIMER_NPM2100_H_ */
@@ -0,0 +1,270 @@
+/** @file
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "clock.h"
+#include "i2c.h"
+#include "mfd_npm2100.h"
+#include "timer_npm2100.h"
+#include "util.h"
+#include "vtimer_npm2100.h"
+
+/* PMIC timer runs at 64 Hz, timeouts shorter than one tick are rounded up */
+#define VTIMER_TICK_MS 16U
+
+/* Timers due within half a tick of the PMIC timer expiry are dispatched together */
+#define VTIMER_TOLERANCE_MS 8U
+
+/* Weight of a new sample in the reprogramming latency average, as a power of two */
+#define VTIMER_LATENCY_SHIFT 2U
+
+static inline bool time_before(uint32_t a, uint32_t b)
+{
+	return (int32_t)(a - b) < 0;
+}
+
+/* heap_idx holds the heap position plus one, 0 means the timer is not running */
+static inline void heap_set(struct vtimer_npm2100 *vt, uint8_t idx, struct vtimer_npm2100_timer *t)
+{
+	vt->heap[idx] = t;
+	t->heap_idx = idx + 1U;
+}
+
+static void heap_sift_up(struct vtimer_npm2100 *vt, uint8_t idx)
+{
+	struct vtimer_npm2100_timer *t = vt->heap[idx];
+
+	while (idx > 0U) {
+		uint8_t parent = (idx - 1U) / 2U;
+
+		if (!time_before(t->deadline_ms, vt->heap[parent]->deadline_ms)) {
+			break;
+		}
+
+		heap_set(vt, idx, vt->heap[parent]);
+		idx = parent;
+	}
+
+	heap_set(vt, idx, t);
+}
+
+static void heap_sift_down(struct vtimer_npm2100 *vt, uint8_t idx)
+{
+	struct vtimer_npm2100_timer *t = vt->heap[idx];
+
+	while (true) {
+		uint8_t child = 2U * idx + 1U;
+
+		if (child >= vt->count) {
+			break;
+		}
+
+		if ((child + 1U < vt->count) &&
+		    time_before(vt->heap[child + 1U]->deadline_ms, vt->heap[child]->deadline_ms)) {
+			child++;
+		}
+
+		if (!time_before(vt->heap[child]->deadline_ms, t->deadline_ms)) {
+			break;
+		}
+
+		heap_set(vt, idx, vt->heap[child]);
+		idx = child;
+	}
+
+	heap_set(vt, idx, t);
+}
+
+static void heap_remove(struct vtimer_npm2100 *vt, struct vtimer_npm2100_timer *t)
+{
+	uint8_t idx = t->heap_idx - 1U;
+
+	t->heap_idx = 0U;
+	vt->count--;
+
+	if (idx == vt->count) {
+		return;
+	}
+
+	/* Move the last timer into the hole and restore heap order in either direction */
+	t = vt->heap[vt->count];
+	heap_set(vt, idx, t);
+	heap_sift_up(vt, idx);
+	heap_sift_down(vt, t->heap_idx - 1U);
+}
+
+/* Program the PMIC timer for the nearest deadline, if it changed */
+static int program(struct vtimer_npm2100 *vt)
+{
+	uint32_t start_us;
+	uint32_t deadline;
+	uint32_t remaining;
+	uint32_t correction;
+	uint32_t now;
+	int ret;
+
+	if (vt->count == 0U) {
+		if (!vt->programmed) {
+			return 0;
+		}
+
+		vt->programmed = false;
+		return mfd_npm2100_stop_timer(vt->dev);
+	}
+
+	deadline = vt->heap[0]->deadline_ms;
+	if (vt->programmed && (deadline == vt->programmed_deadline_ms)) {
+		return 0;
+	}
+
+	start_us = clock_get_us();
+	now = clock_get_ms();
+	remaining = time_before(now, deadline) ? deadline - now : 0U;
+
+	/* The PMIC timer starts counting when the start task is written,
+	 * compensate for the time spent reprogramming it
+	 */
+	correction = DIV_ROUND_UP(vt->latency_us, 1000U);
+	remaining = (remaining > correction) ? remaining - correction : 0U;
+	if (remaining < VTIMER_TICK_MS) {
+		remaining = VTIMER_TICK_MS;
+	}
+
+	vt->programmed = false;
+
+	ret = timer_npm2100_reconfigure(vt->dev, remaining, NPM2100_TIMER_MODE_GENERAL_PURPOSE,
+					NULL);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = mfd_npm2100_start_timer(vt->dev);
+	if (ret < 0) {
+		return ret;
+	}
+
+	vt->latency_us -= vt->latency_us >> VTIMER_LATENCY_SHIFT;
+	vt->latency_us += (clock_get_us() - start_us) >> VTIMER_LATENCY_SHIFT;
+	vt->programmed = true;
+	vt->programmed_deadline_ms = deadline;
+	vt->reprograms++;
+
+	return 0;
+}
+
+int vtimer_npm2100_init(struct vtimer_npm2100 *vt, struct i2c_dev *dev,
+			struct vtimer_npm2100_timer **heap, uint8_t capacity)
+{
+	vt->dev = dev;
+	vt->heap = heap;
+	vt->capacity = capacity;
+	vt->count = 0U;
+	vt->programmed = false;
+	vt->dispatching = false;
+	vt->programmed_deadline_ms = 0U;
+	vt->latency_us = 0U;
+	vt->reprograms = 0U;
+	vt->errors = 0U;
+	vt->last_error = 0;
+
+	return mfd_npm2100_enable_events(dev, BIT(NPM2100_EVENT_SYS_TIMER_EXPIRY));
+}
+
+int vtimer_npm2100_start(struct vtimer_npm2100 *vt, struct vtimer_npm2100_timer *timer,
+			 uint32_t timeout_ms, vtimer_npm2100_handler_t handler, void *user_data)
+{
+	if (timer->heap_idx != 0U) {
+		heap_remove(vt, timer);
+	} else if (vt->count >= vt->capacity) {
+		return -ENOMEM;
+	}
+
+	timer->deadline_ms = clock_get_ms() + timeout_ms;
+	timer->handler = handler;
+	timer->user_data = user_data;
+
+	vt->heap[vt->count] = timer;
+	vt->count++;
+	heap_sift_up(vt, vt->count - 1U);
+
+	/* Reprogrammed once all expired timers are dispatched */
+	if (vt->dispatching) {
+		return 0;
+	}
+
+	return program(vt);
+}
+
+int vtimer_npm2100_stop(struct vtimer_npm2100 *vt, struct vtimer_npm2100_timer *timer)
+{
+	if (timer->heap_idx == 0U) {
+		return 0;
+	}
+
+	heap_remove(vt, timer);
+
+	if (vt->dispatching) {
+		return 0;
+	}
+
+	return program(vt);
+}
+
+bool vtimer_npm2100_is_running(const struct vtimer_npm2100_timer *timer)
+{
+	return timer->heap_idx != 0U;
+}
+
+int vtimer_npm2100_process_events(struct vtimer_npm2100 *vt, uint32_t events)
+{
+	uint32_t now;
+
+	if ((events & BIT(NPM2100_EVENT_SYS_TIMER_EXPIRY)) == 0U) {
+		return 0;
+	}
+
+	/* Timer is idle after a general purpose expiry */
+	vt->programmed = false;
+	vt->dispatching = true;
+	now = clock_get_ms() + VTIMER_TOLERANCE_MS;
+
+	while ((vt->count > 0U) && !time_before(now, vt->heap[0]->deadline_ms)) {
+		struct vtimer_npm2100_timer *timer = vt->heap[0];
+
+		heap_remove(vt, timer);
+		timer->handler(vt, timer, timer->user_data);
+	}
+
+	vt->dispatching = false;
+
+	return program(vt);
+}
+
+void vtimer_npm2100_expiry_handler(struct i2c_dev *dev, enum mfd_npm2100_event_t event,
+				   void *user_data)
+{
+	struct vtimer_npm2100 *vt = user_data;
+	int ret;
+
+	(void)dev;
+
+	ret = vtimer_npm2100_process_events(vt, BIT(event));
+	if (ret < 0) {
+		vt->errors++;
+		vt->last_error = ret;
+	}
+}
+
+void vtimer_npm2100_get_stats(const struct vtimer_npm2100 *vt, struct vtimer_npm2100_stats *stats)
+{
+	stats->reprograms = vt->reprograms;
+	stats->correction_us = vt->latency_us;
+	stats->errors = vt->errors;
+	stats->last_error = vt->last_error;
+}
@@ -0,0 +1,150 @@
+/** @file
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef VTIMER_NPM2100_H_
+#define VTIMER_NPM2100_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "i2c.h"
+#include "mfd_npm2100.h"
+
+struct vtimer_npm2100;
+struct vtimer_npm2100_timer;
+
+/**
+ * @brief Virtual timer expiry handler
+ *
+ * Called from vtimer_npm2100_process_events context. The handler may start or stop timers,
+ * including the expired one.
+ *
+ * @param vt virtual timer service.
+ * @param timer expired timer.
+ * @param user_data user context given when the timer was started.
+ */
+typedef void (*vtimer_npm2100_handler_t)(struct vtimer_npm2100 *vt,
+					 struct vtimer_npm2100_timer *timer, void *user_data);
+
+/**
+ * @brief Virtual timer
+ *
+ * Storage is owned by the caller and must be zero-initialised before the timer is first
+ * started, a zero heap_idx marks it as not running. Fields are private.
+ */
+struct vtimer_npm2100_timer {
+	uint32_t deadline_ms;
+	vtimer_npm2100_handler_t handler;
+	void *user_data;
+	uint8_t heap_idx;
+};
+
+/**
+ * @brief Virtual timer service statistics
+ */
+struct vtimer_npm2100_stats {
+	uint32_t reprograms;    /* number of times the PMIC timer was programmed */
+	uint32_t correction_us; /* current correction applied for reprogramming latency */
+	uint32_t errors;        /* failures in vtimer_npm2100_expiry_handler */
+	int last_error;         /* -errno of the latest such failure, 0 if none */
+};
+
+/**
+ * @brief Virtual timer service
+ *
+ * Multiplexes the single nPM2100 timer. While the service is in use the PMIC timer must not
+ * be used by mfd_npm2100_set_timer, watchdog_npm2100_init or mfd_npm2100_hibernate.
+ * Fields are private.
+ */
+struct vtimer_npm2100 {
+	struct i2c_dev *dev;
+	struct vtimer_npm2100_timer **heap;
+	uint8_t capacity;
+	uint8_t count;
+	bool programmed;
+	bool dispatching;
+	uint32_t programmed_deadline_ms;
+	uint32_t latency_us;
+	uint32_t reprograms;
+	uint32_t errors;
+	int last_error;
+};
+
+/**
+ * @brief Initialise virtual timer service
+ *
+ * Enables the timer expiry event. The expiry must be routed to vtimer_npm2100_process_events,
+ * either directly or through vtimer_npm2100_expiry_handler in an event callback table.
+ *
+ * @param vt virtual timer service.
+ * @param dev device pointer, passed to i2c hal layer.
+ * @param heap storage for @p capacity timer pointers.
+ * @param capacity maximum number of simultaneously running timers.
+ * @return 0 on success, -errno on failure
+ */
+int vtimer_npm2100_init(struct vtimer_npm2100 *vt, struct i2c_dev *dev,
+			struct vtimer_npm2100_timer **heap, uint8_t capacity);
+
+/**
+ * @brief Start or restart a virtual timer
+ *
+ * The PMIC timer is only reprogrammed if the nearest deadline changes.
+ *
+ * @param vt virtual timer service.
+ * @param timer timer to start, zero-initialised before its first start.
+ * @param timeout_ms timeout in ms, resolution is one PMIC timer tick (15.625 ms).
+ * @param handler expiry handler.
+ * @param user_data user context passed to the handler.
+ * @return 0 on success, -ENOMEM if @p capacity timers are running, -errno on bus failure
+ */
+int vtimer_npm2100_start(struct vtimer_npm2100 *vt, struct vtimer_npm2100_timer *timer,
+			 uint32_t timeout_ms, vtimer_npm2100_handler_t handler, void *user_data);
+
+/**
+ * @brief Stop a virtual timer
+ *
+ * @param vt virtual timer service.
+ * @param timer timer to stop, stopping a timer that is not running has no effect.
+ * @return 0 on success, -errno on bus failure
+ */
+int vtimer_npm2100_stop(struct vtimer_npm2100 *vt, struct vtimer_npm2100_timer *timer);
+
+/**
+ * @brief Check whether a virtual timer is running
+ *
+ * @param timer timer to check.
+ * @return true if running
+ */
+bool vtimer_npm2100_is_running(const struct vtimer_npm2100_timer *timer);
+
+/**
+ * @brief Dispatch expired virtual timers
+ *
+ * @param vt virtual timer service.
+ * @param events bitfield of events, as returned by mfd_npm2100_process_events
+ * @return 0 on success, -errno on bus failure
+ */
+int vtimer_npm2100_process_events(struct vtimer_npm2100 *vt, uint32_t events);
+
+/**
+ * @brief Timer expiry event handler
+ *
+ * Can be registered for NPM2100_EVENT_SYS_TIMER_EXPIRY in an event callback table,
+ * with the virtual timer service as user data. A bus failure leaves the PMIC timer
+ * unprogrammed and is counted in the statistics. To recover, call
+ * vtimer_npm2100_process_events with BIT(NPM2100_EVENT_SYS_TIMER_EXPIRY) again.
+ */
+void vtimer_npm2100_expiry_handler(struct i2c_dev *dev, enum mfd_npm2100_event_t event,
+				   void *user_data);
+
+/**
+ * @brief Get virtual timer service statistics
+ *
+ * @param vt virtual timer service.
+ * @param[out] stats Where statistics will be stored.
+ */
+void vtimer_npm2100_get_stats(const struct vtimer_npm2100 *vt, struct vtimer_npm2100_stats *stats);
+
+#endif /* VTIMER_NPM2100_H_ */
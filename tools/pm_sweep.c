@@ -0,0 +1,119 @@
+/** @file
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/* Energy and latency trade-off of the power manager sleep states per sleep length.
+ *
+ * Sweeps sleep lengths through the pm_npm2100 cost model and prints, for each length, the
+ * modelled energy of every state, the selected state, its wakeup latency and the energy saved
+ * compared to idle. The cost model below is an example, replace it with the values measured
+ * on the product. The cost of pm_npm2100_select is timed on the host.
+ *
+ * Usage: pm_sweep [sleep_ms]...
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "i2c.h"
+#include "pm_npm2100.h"
+#include "util.h"
+
+#define SELECT_RUNS 1000000U
+
+static const char *const state_names[PM_NPM2100_STATE_COUNT] = {
+	[PM_NPM2100_STATE_IDLE] = "idle",
+	[PM_NPM2100_STATE_SYSTEM_OFF] = "sysoff",
+	[PM_NPM2100_STATE_HIBERNATE_PT] = "hib-pt",
+	[PM_NPM2100_STATE_HIBERNATE] = "hib",
+};
+
+static void enter(enum pm_npm2100_state state, uint32_t sleep_ms, void *user_data)
+{
+	(void)state;
+	(void)sleep_ms;
+	(void)user_data;
+}
+
+static const struct pm_npm2100_config pm_config = {
+	.states = BIT(PM_NPM2100_STATE_SYSTEM_OFF) | BIT(PM_NPM2100_STATE_HIBERNATE_PT) |
+		  BIT(PM_NPM2100_STATE_HIBERNATE),
+	.cost = {
+		[PM_NPM2100_STATE_IDLE] = {.power_uw = 9, .wakeup_uj = 0, .latency_us = 10},
+		[PM_NPM2100_STATE_SYSTEM_OFF] = {.power_uw = 3, .wakeup_uj = 10, .latency_us = 400},
+		[PM_NPM2100_STATE_HIBERNATE_PT] = {.power_uw = 2, .wakeup_uj = 30,
+						   .latency_us = 1000},
+		[PM_NPM2100_STATE_HIBERNATE] = {.power_uw = 1, .wakeup_uj = 200,
+						.latency_us = 3000},
+	},
+	.enter = enter,
+};
+
+static void print_row(const struct pm_npm2100 *pm, uint32_t sleep_ms)
+{
+	enum pm_npm2100_state selected = pm_npm2100_select(pm, sleep_ms);
+	uint32_t idle_uj = pm_npm2100_energy_uj(pm, PM_NPM2100_STATE_IDLE, sleep_ms);
+	uint32_t selected_uj = pm_npm2100_energy_uj(pm, selected, sleep_ms);
+
+	printf("%10u", sleep_ms);
+
+	for (int i = 0; i < PM_NPM2100_STATE_COUNT; i++) {
+		printf(" %10u", pm_npm2100_energy_uj(pm, i, sleep_ms));
+	}
+
+	printf(" | %8s %8u %8.1f%%\n", state_names[selected],
+	       pm_config.cost[selected].latency_us,
+	       (idle_uj == 0U) ? 0.0 : 100.0 * (idle_uj - selected_uj) / idle_uj);
+}
+
+int main(int argc, char **argv)
+{
+	static const uint32_t default_sleeps_ms[] = {10U,    100U,    1000U,   2000U,  5000U,
+						     10000U, 20000U,  50000U,  100000U, 200000U,
+						     1000000U};
+	struct pm_npm2100 pm;
+	struct i2c_dev dev = {0};
+	volatile uint32_t sink = 0U;
+	struct timespec start;
+	struct timespec end;
+	double select_ns;
+
+	pm_npm2100_init(&pm, &dev, &pm_config);
+
+	printf("thresholds:");
+	for (int i = 0; i < PM_NPM2100_STATE_COUNT; i++) {
+		printf(" %s %u ms", state_names[i], pm_npm2100_threshold_ms(&pm, i));
+	}
+	printf("\n\n");
+
+	printf("%10s", "sleep ms");
+	for (int i = 0; i < PM_NPM2100_STATE_COUNT; i++) {
+		printf(" %7s uJ", state_names[i]);
+	}
+	printf(" | %8s %8s %9s\n", "selected", "lat us", "saved");
+
+	if (argc > 1) {
+		for (int i = 1; i < argc; i++) {
+			print_row(&pm, (uint32_t)strtoul(argv[i], NULL, 0));
+		}
+	} else {
+		for (size_t i = 0U; i < ARRAY_SIZE(default_sleeps_ms); i++) {
+			print_row(&pm, default_sleeps_ms[i]);
+		}
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (uint32_t i = 0U; i < SELECT_RUNS; i++) {
+		sink += pm_npm2100_select(&pm, i);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	select_ns = ((end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec)) /
+		    SELECT_RUNS;
+	printf("\npm_npm2100_select: %.1f ns per call on the host\n", select_ns);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,132 @@
+/** @file
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/* Host implementation of the i2c and clock hal, backed by a simulated nPM2100 register file and
+ * a simulated host clock. Only the timer is modelled, other registers read back what was
+ * written.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "clock.h"
+#include "i2c.h"
+#include "mfd_npm2100.h"
+#include "sim_npm2100.h"
+
+#define TIMER_TASKS_START 0xB0U
+#define TIMER_TASKS_STOP  0xB1U
+#define TIMER_TARGET      0xB4U
+#define TIMER_STATUS      0xB7U
+
+#define TIMER_STATUS_IDLE    0U
+#define TIMER_STATUS_RUNNING 1U
+
+#define TICK_US (1000000U / NPM2100_TIMER_TICK_HZ)
+
+static uint8_t regs[256];
+static uint64_t now_us;
+static uint64_t timer_start_us;
+
+static uint32_t timer_target(void)
+{
+	return ((uint32_t)regs[TIMER_TARGET] << 16) | ((uint32_t)regs[TIMER_TARGET + 1U] << 8) |
+	       regs[TIMER_TARGET + 2U];
+}
+
+static void reg_write(uint8_t reg, uint8_t value)
+{
+	switch (reg) {
+	case TIMER_TASKS_START:
+		timer_start_us = now_us;
+		regs[TIMER_STATUS] = TIMER_STATUS_RUNNING;
+		break;
+	case TIMER_TASKS_STOP:
+		regs[TIMER_STATUS] = TIMER_STATUS_IDLE;
+		break;
+	default:
+		regs[reg] = value;
+		break;
+	}
+}
+
+int i2c_write(struct i2c_dev *dev, uint8_t *buf, size_t len)
+{
+	(void)dev;
+
+	for (size_t i = 1U; i < len; i++) {
+		reg_write((uint8_t)(buf[0] + i - 1U), buf[i]);
+	}
+
+	return 0;
+}
+
+int i2c_read(struct i2c_dev *dev, uint8_t reg, uint8_t *buf, size_t len)
+{
+	(void)dev;
+
+	for (size_t i = 0U; i < len; i++) {
+		buf[i] = regs[(uint8_t)(reg + i)];
+	}
+
+	return 0;
+}
+
+int i2c_reg_write_byte(struct i2c_dev *dev, uint8_t reg, uint8_t data)
+{
+	return i2c_write(dev, (uint8_t[]){reg, data}, 2U);
+}
+
+int i2c_reg_read_byte(struct i2c_dev *dev, uint8_t reg, uint8_t *data)
+{
+	return i2c_read(dev, reg, data, 1U);
+}
+
+int i2c_reg_update_byte(struct i2c_dev *dev, uint8_t reg, uint8_t mask, uint8_t data)
+{
+	(void)dev;
+
+	reg_write(reg, (regs[reg] & ~mask) | (data & mask));
+
+	return 0;
+}
+
+uint32_t clock_get_ms(void)
+{
+	return (uint32_t)(now_us / 1000U);
+}
+
+uint32_t clock_get_us(void)
+{
+	return (uint32_t)now_us;
+}
+
+void clock_delay_us(uint32_t us)
+{
+	now_us += us;
+}
+
+void sim_npm2100_set_time_us(uint64_t time_us)
+{
+	now_us = time_us;
+}
+
+uint64_t sim_npm2100_time_us(void)
+{
+	return now_us;
+}
+
+bool sim_npm2100_timer_expiry_us(uint64_t *expiry_us)
+{
+	*expiry_us = timer_start_us + (uint64_t)timer_target() * TICK_US;
+
+	return regs[TIMER_STATUS] != TIMER_STATUS_IDLE;
+}
+
+void sim_npm2100_timer_expired(void)
+{
+	regs[TIMER_STATUS] = TIMER_STATUS_IDLE;
+}
@@ -0,0 +1,46 @@
+/** @file
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef SIM_NPM2100_H_
+#define SIM_NPM2100_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Set the simulated host time
+ *
+ * The hal clock functions return this time, clock_delay_us advances it.
+ *
+ * @param now_us time in us since the start of the simulation.
+ */
+void sim_npm2100_set_time_us(uint64_t now_us);
+
+/**
+ * @brief Get the simulated host time
+ *
+ * @return Time in us since the start of the simulation
+ */
+uint64_t sim_npm2100_time_us(void);
+
+/**
+ * @brief Get the expiry time of the simulated PMIC timer
+ *
+ * The timer starts counting when its start task is written, and expires after the ticks last
+ * written to its target register.
+ *
+ * @param[out] expiry_us Where the expiry time in us will be stored.
+ * @return true if the timer is running
+ */
+bool sim_npm2100_timer_expiry_us(uint64_t *expiry_us);
+
+/**
+ * @brief Report the simulated PMIC timer expired
+ *
+ * The timer turns idle, as after a general purpose expiry.
+ */
+void sim_npm2100_timer_expired(void);
+
+#endif /* SIM_NPM2100_H_ */
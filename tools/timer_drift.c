@@ -0,0 +1,160 @@
+/** @file
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/* Drift of a periodic PMIC timer over 24 simulated hours.
+ *
+ * Compares two ways of running the timer periodically on a simulated nPM2100:
+ * - restart: the period is set once with mfd_npm2100_set_timer, and the timer is started again
+ *   after each expiry has been processed, as the example used to do.
+ * - periodic: timer_npm2100_periodic_restart is called on each expiry.
+ * Each expiry is handled after a random latency, standing in for interrupt, I2C and processing
+ * time. The drift is the time by which the last expiry misses the ideal period grid, the
+ * maximum error is the largest such miss over the run.
+ *
+ * Usage: timer_drift [period_ms]...
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "i2c.h"
+#include "mfd_npm2100.h"
+#include "sim_npm2100.h"
+#include "timer_npm2100.h"
+
+#define SIM_DURATION_US (24ULL * 3600U * 1000000U)
+
+/* Expiry handling latency range */
+#define LATENCY_MIN_US 500U
+#define LATENCY_MAX_US 3000U
+
+struct result {
+	uint64_t expiries;
+	int64_t drift_us;
+	int64_t max_error_us;
+};
+
+static uint32_t latency_us(void)
+{
+	return LATENCY_MIN_US + (uint32_t)rand() % (LATENCY_MAX_US - LATENCY_MIN_US);
+}
+
+/* Record the error of an expiry against the ideal period grid */
+static void record(struct result *res, int64_t error_us)
+{
+	res->expiries++;
+	res->drift_us = error_us;
+
+	if (llabs(error_us) > res->max_error_us) {
+		res->max_error_us = llabs(error_us);
+	}
+}
+
+static int run_restart(struct i2c_dev *dev, uint32_t period_ms, struct result *res)
+{
+	const uint64_t period_us = period_ms * 1000ULL;
+	uint64_t expiry_us;
+	int ret;
+
+	sim_npm2100_set_time_us(0U);
+
+	ret = mfd_npm2100_set_timer(dev, period_ms, NPM2100_TIMER_MODE_GENERAL_PURPOSE);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = mfd_npm2100_start_timer(dev);
+	if (ret < 0) {
+		return ret;
+	}
+
+	while (sim_npm2100_timer_expiry_us(&expiry_us) && (expiry_us <= SIM_DURATION_US)) {
+		sim_npm2100_timer_expired();
+
+		/* Each period starts where the previous one was handled, the error accumulates */
+		record(res, (int64_t)expiry_us - (int64_t)((res->expiries + 1U) * period_us));
+
+		sim_npm2100_set_time_us(expiry_us + latency_us());
+
+		ret = mfd_npm2100_start_timer(dev);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	return mfd_npm2100_stop_timer(dev);
+}
+
+static int run_periodic(struct i2c_dev *dev, uint32_t period_ms, struct result *res)
+{
+	const uint64_t period_us = period_ms * 1000ULL;
+	struct timer_npm2100_periodic periodic;
+	uint64_t expiry_us;
+	uint64_t grid_us;
+	int ret;
+
+	sim_npm2100_set_time_us(0U);
+
+	ret = timer_npm2100_periodic_start(&periodic, dev, period_ms);
+	if (ret < 0) {
+		return ret;
+	}
+
+	while (sim_npm2100_timer_expiry_us(&expiry_us) && (expiry_us <= SIM_DURATION_US)) {
+		sim_npm2100_timer_expired();
+
+		/* Missed periods are skipped, compare against the nearest grid point */
+		grid_us = (expiry_us + period_us / 2U) / period_us * period_us;
+		record(res, (int64_t)expiry_us - (int64_t)grid_us);
+
+		sim_npm2100_set_time_us(expiry_us + latency_us());
+
+		ret = timer_npm2100_periodic_restart(&periodic);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	return timer_npm2100_periodic_stop(&periodic);
+}
+
+int main(int argc, char **argv)
+{
+	static const uint32_t default_periods_ms[] = {100U, 1000U, 2000U, 60000U};
+	struct i2c_dev dev = {0};
+	int count = (argc > 1) ? argc - 1 : (int)(sizeof(default_periods_ms) / sizeof(uint32_t));
+
+	printf("%10s %10s | %10s %12s | %10s %12s %12s\n", "period ms", "ideal", "restart",
+	       "drift ms", "periodic", "drift ms", "max err ms");
+
+	for (int i = 0; i < count; i++) {
+		uint32_t period_ms = (argc > 1) ? (uint32_t)strtoul(argv[i + 1], NULL, 0)
+						: default_periods_ms[i];
+		struct result restart = {0};
+		struct result periodic = {0};
+
+		/* Same latency sequence for both */
+		srand(1U);
+		if (run_restart(&dev, period_ms, &restart) < 0) {
+			fprintf(stderr, "restart: period %u ms failed\n", period_ms);
+			return EXIT_FAILURE;
+		}
+
+		srand(1U);
+		if (run_periodic(&dev, period_ms, &periodic) < 0) {
+			fprintf(stderr, "periodic: period %u ms not supported\n", period_ms);
+			return EXIT_FAILURE;
+		}
+
+		printf("%10u %10llu | %10llu %12.1f | %10llu %12.1f %12.1f\n", period_ms,
+		       (unsigned long long)(SIM_DURATION_US / (period_ms * 1000ULL)),
+		       (unsigned long long)restart.expiries, restart.drift_us / 1000.0,
+		       (unsigned long long)periodic.expiries, periodic.drift_us / 1000.0,
+		       periodic.max_error_us / 1000.0);
+	}
+
+	return EXIT_SUCCESS;
+}